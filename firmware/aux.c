@@ -22,30 +22,272 @@
 #define AUX_F7_ABS2    0x27
 #define AUX_F7_CLIP16  0x28
 #define AUX_F7_SHIFTN  0x29
+#define AUX_F7_MACA    0x2A
+#define AUX_F7_ACCRD   0x2B
+#define AUX_F7_ACCCLR  0x2C
+#define AUX_F7_BIQUAD  0x2D
+#define AUX_F7_BFLY    0x2E
+#define AUX_F7_LANE16  0x2F
+#define AUX_F7_MULQ15  0x30
+#define AUX_F7_NORM    0x31
+#define AUX_F7_LOG2Q   0x32
+#define AUX_F7_CIRC    0x33
+#define AUX_F7_MACC16  0x34
+#define AUX_F7_MSUBC16 0x35
+#define AUX_F7_MINMAX  0x36
+#define AUX_F7_ENVF    0x37
+#define AUX_F7_CORDIC  0x38
+#define AUX_F7_MEDIAN  0x39
+#define AUX_F7_LERP16  0x3A
+#define AUX_F7_AREG    0x3B
+#define AUX_F7_SATST   0x3C
 
-#define AUX_ENC_R(F7, RD, RS1, RS2) \
+/* LP.SETUP is a core instruction, not an AUX op: it uses a free funct7
+ * below the AUX range, next to the IRQ instructions (0..5). */
+#define AUX_F7_LPSETUP 0x06
+
+/* LW.PI/SW.PI are core instructions as well: a 32-bit word (two packed
+ * int16 samples) at 0(rs1), then rs1 += step. funct3 = 010 (word). */
+#define AUX_F7_LWPI    0x07
+#define AUX_F7_SWPI    0x08
+#define AUX_F3_PI_WORD 0x2
+
+/* funct3 sub-operations of CONV8 */
+#define AUX_F3_CONV8_WORD 0x0
+#define AUX_F3_CONV8_SETH 0x1
+#define AUX_F3_CONV8_PUSH 0x2
+#define AUX_F3_CONV8_CLR  0x3
+
+/* funct3 sub-operations of LMSSTEP */
+#define AUX_F3_LMS_STEP 0x0
+#define AUX_F3_LMS_SETC 0x1
+#define AUX_F3_LMS_GETC 0x2
+#define AUX_F3_LMS_CFG  0x3
+#define AUX_F3_LMS_CLR  0x4
+
+/* MACA/ACCRD/ACCCLR: funct3[1:0] = accumulator, funct3[2] = variant
+ * (MACA.8, ACCRD.16, ACCSET) */
+#define AUX_F3_ACC_ALT  0x4
+
+/* funct3 sub-operations of BIQUAD */
+#define AUX_F3_BQ_STEP 0x0
+#define AUX_F3_BQ_SETC 0x1
+#define AUX_F3_BQ_CLR  0x2
+
+/* funct3 sub-operations of BFLY */
+#define AUX_F3_BFLY_TW    0x0
+#define AUX_F3_BFLY_TWK   0x1
+#define AUX_F3_BFLY       0x2
+#define AUX_F3_BFLY_SCALE 0x3
+#define AUX_F3_BFLY_DIFF  0x4
+
+/* funct3 sub-operations of LANE16 */
+#define AUX_F3_ADD16S 0x0
+#define AUX_F3_SUB16S 0x1
+#define AUX_F3_PKLO   0x2
+#define AUX_F3_PKHI   0x3
+#define AUX_F3_SXTLO  0x4
+#define AUX_F3_SXTHI  0x5
+
+/* funct3 variants of MULQ15 */
+#define AUX_F3_MULQ15_TRUNC 0x0
+#define AUX_F3_MULQ15_RND   0x1
+
+/* funct3 sub-operations of NORM */
+#define AUX_F3_NORM_RECIP 0x0
+#define AUX_F3_NORM_RSQRT 0x1
+#define AUX_F3_NORM_SQRT  0x2
+
+/* funct3 sub-operations of LOG2Q */
+#define AUX_F3_LOG2Q 0x0
+#define AUX_F3_EXP2Q 0x1
+
+/* funct3 sub-operations of CIRC (rs2 = pointer) */
+#define AUX_F3_CIRC_NEXT 0x0
+#define AUX_F3_CIRC_SETB 0x1
+#define AUX_F3_CIRC_SETL 0x2
+#define AUX_F3_CIRC_GETI 0x3
+#define AUX_F3_CIRC_SETI 0x4
+#define AUX_F3_CIRC_ADDR 0x5
+
+/* funct3 sub-operations of MINMAX */
+#define AUX_F3_MIN16    0x0
+#define AUX_F3_MAX16    0x1
+#define AUX_F3_MAXABS16 0x2
+#define AUX_F3_PEAK     0x3
+#define AUX_F3_PKCFG    0x4
+#define AUX_F3_PKCLR    0x5
+
+/* funct3 sub-operations of ENVF (rs2 = channel) */
+#define AUX_F3_ENVF_LVL 0x0
+#define AUX_F3_ENVF_ABS 0x1
+#define AUX_F3_ENVF_SQ  0x2
+#define AUX_F3_ENVF_CFG 0x3
+#define AUX_F3_ENVF_SET 0x4
+
+/* funct3 sub-operations of CORDIC */
+#define AUX_F3_COR_SINCOS 0x0
+#define AUX_F3_COR_ATAN2  0x1
+#define AUX_F3_COR_MAG    0x2
+
+/* funct3 sub-operations of MEDIAN */
+#define AUX_F3_MED3    0x0
+#define AUX_F3_MED5    0x1
+#define AUX_F3_MED_CLR 0x2
+
+/* funct3 variants of LERP16 */
+#define AUX_F3_LERP16   0x0
+#define AUX_F3_LERP16X2 0x1
+
+/* funct3 sub-operations of AREG (rs2 field = audio register number) */
+#define AUX_F3_ARW     0x0
+#define AUX_F3_ARR     0x1
+#define AUX_F3_MAC16A  0x2
+#define AUX_F3_MACC16A 0x3
+#define AUX_F3_MULQ15A 0x4
+#define AUX_F3_CONV4A  0x5
+
+/* funct3 of SHIFTN: rounding mode, plus AUX_F3_SHN_W for the 64-bit
+ * {rs2, rs1} form with the control word in rd */
+#define AUX_F3_SHN_AWAY  0x0
+#define AUX_F3_SHN_TRUNC 0x1
+#define AUX_F3_SHN_EVEN  0x2
+#define AUX_F3_SHN_W     0x4
+
+/* funct3 sub-operations of SATST */
+#define AUX_F3_SATRD  0x0
+#define AUX_F3_SATCLR 0x1
+
+#define AUX_ENC_RF(F7, F3, RD, RS1, RS2) \
     ((((uint32_t)(F7)  & 0x7f) << 25) | \
      (((uint32_t)(RS2) & 0x1f) << 20) | \
      (((uint32_t)(RS1) & 0x1f) << 15) | \
-     (((uint32_t)AUX_FUNCT3 & 0x7) << 12) | \
+     (((uint32_t)(F3)  & 0x7) << 12) | \
      (((uint32_t)(RD)  & 0x1f) << 7)  | \
      ((uint32_t)AUX_OPCODE & 0x7f))
 
+#define AUX_ENC_R(F7, RD, RS1, RS2) AUX_ENC_RF(F7, AUX_FUNCT3, RD, RS1, RS2)
+
 #define AUX_RD_A0   10u  /* x10 / a0 */
+#define AUX_RD_X0    0u  /* ops without writeback */
 #define AUX_RS1_A0  10u
 #define AUX_RS2_A1  11u  /* x11 / a1 */
 #define AUX_RS2_X0   0u  /* x0  / zero */
+#define AUX_RS1_A1  11u  /* MACC16/MSUBC16: rd = a0 is also a source */
+#define AUX_RS2_A2  12u  /* x12 / a2 */
 
 #define AUX_MAC16_ENC    AUX_ENC_R(AUX_F7_MAC16,   AUX_RD_A0, AUX_RS1_A0, AUX_RS2_A1)
 #define AUX_MSUB16_ENC   AUX_ENC_R(AUX_F7_MSUB16,  AUX_RD_A0, AUX_RS1_A0, AUX_RS2_A1)
 #define AUX_ABS16_ENC    AUX_ENC_R(AUX_F7_ABS16,   AUX_RD_A0, AUX_RS1_A0, AUX_RS2_X0)
 #define AUX_CONV4_ENC    AUX_ENC_R(AUX_F7_CONV4,   AUX_RD_A0, AUX_RS1_A0, AUX_RS2_A1)
 #define AUX_CONV8_ENC    AUX_ENC_R(AUX_F7_CONV8,   AUX_RD_A0, AUX_RS1_A0, AUX_RS2_A1)
+#define AUX_CONV8_SETH_ENC AUX_ENC_RF(AUX_F7_CONV8, AUX_F3_CONV8_SETH, AUX_RD_A0, AUX_RS1_A0, AUX_RS2_X0)
+#define AUX_CONV8_PUSH_ENC AUX_ENC_RF(AUX_F7_CONV8, AUX_F3_CONV8_PUSH, AUX_RD_A0, AUX_RS1_A0, AUX_RS2_A1)
+#define AUX_CONV8_CLR_ENC  AUX_ENC_RF(AUX_F7_CONV8, AUX_F3_CONV8_CLR,  AUX_RD_A0, AUX_RS1_A0, AUX_RS2_X0)
 #define AUX_LMSSTEP_ENC  AUX_ENC_R(AUX_F7_LMSSTEP, AUX_RD_A0, AUX_RS1_A0, AUX_RS2_A1)
+#define AUX_LMS_SETC_ENC AUX_ENC_RF(AUX_F7_LMSSTEP, AUX_F3_LMS_SETC, AUX_RD_A0, AUX_RS1_A0, AUX_RS2_A1)
+#define AUX_LMS_GETC_ENC AUX_ENC_RF(AUX_F7_LMSSTEP, AUX_F3_LMS_GETC, AUX_RD_A0, AUX_RS1_A0, AUX_RS2_X0)
+#define AUX_LMS_CFG_ENC  AUX_ENC_RF(AUX_F7_LMSSTEP, AUX_F3_LMS_CFG,  AUX_RD_A0, AUX_RS1_A0, AUX_RS2_A1)
+#define AUX_LMS_CLR_ENC  AUX_ENC_RF(AUX_F7_LMSSTEP, AUX_F3_LMS_CLR,  AUX_RD_A0, AUX_RS1_A0, AUX_RS2_X0)
 #define AUX_CMAC_ENC     AUX_ENC_R(AUX_F7_CMAC,    AUX_RD_A0, AUX_RS1_A0, AUX_RS2_A1)
 #define AUX_ABS2_ENC     AUX_ENC_R(AUX_F7_ABS2,    AUX_RD_A0, AUX_RS1_A0, AUX_RS2_X0)
 #define AUX_CLIP16_ENC   AUX_ENC_R(AUX_F7_CLIP16,  AUX_RD_A0, AUX_RS1_A0, AUX_RS2_A1)
 #define AUX_SHIFTN_ENC   AUX_ENC_R(AUX_F7_SHIFTN,  AUX_RD_A0, AUX_RS1_A0, AUX_RS2_A1)
+#define AUX_SHIFTN_RM_ENC(F3) AUX_ENC_RF(AUX_F7_SHIFTN, F3, AUX_RD_A0, AUX_RS1_A0, AUX_RS2_A1)
+#define AUX_SHIFTN64_ENC(F3)  AUX_ENC_RF(AUX_F7_SHIFTN, AUX_F3_SHN_W | (F3), AUX_RD_A0, AUX_RS1_A1, AUX_RS2_A2)
+#define AUX_MACA_ENC(F3)   AUX_ENC_RF(AUX_F7_MACA,   F3, AUX_RD_X0, AUX_RS1_A0, AUX_RS2_A1)
+#define AUX_ACCRD_ENC(F3)  AUX_ENC_RF(AUX_F7_ACCRD,  F3, AUX_RD_A0, AUX_RS1_A0, AUX_RS2_X0)
+#define AUX_ACCCLR_ENC(F3) AUX_ENC_RF(AUX_F7_ACCCLR, F3, AUX_RD_X0, AUX_RS1_A0, AUX_RS2_X0)
+#define AUX_BQ_STEP_ENC  AUX_ENC_RF(AUX_F7_BIQUAD, AUX_F3_BQ_STEP, AUX_RD_A0, AUX_RS1_A0, AUX_RS2_A1)
+#define AUX_BQ_SETC_ENC  AUX_ENC_RF(AUX_F7_BIQUAD, AUX_F3_BQ_SETC, AUX_RD_A0, AUX_RS1_A0, AUX_RS2_A1)
+#define AUX_BQ_CLR_ENC   AUX_ENC_RF(AUX_F7_BIQUAD, AUX_F3_BQ_CLR,  AUX_RD_A0, AUX_RS1_A0, AUX_RS2_X0)
+#define AUX_BFLY_TW_ENC    AUX_ENC_RF(AUX_F7_BFLY, AUX_F3_BFLY_TW,    AUX_RD_A0, AUX_RS1_A0, AUX_RS2_X0)
+#define AUX_BFLY_TWK_ENC   AUX_ENC_RF(AUX_F7_BFLY, AUX_F3_BFLY_TWK,   AUX_RD_A0, AUX_RS1_A0, AUX_RS2_X0)
+#define AUX_BFLY_ENC       AUX_ENC_RF(AUX_F7_BFLY, AUX_F3_BFLY,       AUX_RD_A0, AUX_RS1_A0, AUX_RS2_A1)
+#define AUX_BFLY_SCALE_ENC AUX_ENC_RF(AUX_F7_BFLY, AUX_F3_BFLY_SCALE, AUX_RD_A0, AUX_RS1_A0, AUX_RS2_A1)
+#define AUX_BFLY_DIFF_ENC  AUX_ENC_RF(AUX_F7_BFLY, AUX_F3_BFLY_DIFF,  AUX_RD_A0, AUX_RS1_A0, AUX_RS2_X0)
+#define AUX_ADD16S_ENC AUX_ENC_RF(AUX_F7_LANE16, AUX_F3_ADD16S, AUX_RD_A0, AUX_RS1_A0, AUX_RS2_A1)
+#define AUX_SUB16S_ENC AUX_ENC_RF(AUX_F7_LANE16, AUX_F3_SUB16S, AUX_RD_A0, AUX_RS1_A0, AUX_RS2_A1)
+#define AUX_PKLO_ENC   AUX_ENC_RF(AUX_F7_LANE16, AUX_F3_PKLO,   AUX_RD_A0, AUX_RS1_A0, AUX_RS2_A1)
+#define AUX_PKHI_ENC   AUX_ENC_RF(AUX_F7_LANE16, AUX_F3_PKHI,   AUX_RD_A0, AUX_RS1_A0, AUX_RS2_A1)
+#define AUX_SXTLO_ENC  AUX_ENC_RF(AUX_F7_LANE16, AUX_F3_SXTLO,  AUX_RD_A0, AUX_RS1_A0, AUX_RS2_X0)
+#define AUX_SXTHI_ENC  AUX_ENC_RF(AUX_F7_LANE16, AUX_F3_SXTHI,  AUX_RD_A0, AUX_RS1_A0, AUX_RS2_X0)
+#define AUX_MULQ15_ENC  AUX_ENC_RF(AUX_F7_MULQ15, AUX_F3_MULQ15_TRUNC, AUX_RD_A0, AUX_RS1_A0, AUX_RS2_A1)
+#define AUX_MULQ15R_ENC AUX_ENC_RF(AUX_F7_MULQ15, AUX_F3_MULQ15_RND,   AUX_RD_A0, AUX_RS1_A0, AUX_RS2_A1)
+#define AUX_RECIP_ENC   AUX_ENC_RF(AUX_F7_NORM, AUX_F3_NORM_RECIP, AUX_RD_A0, AUX_RS1_A0, AUX_RS2_X0)
+#define AUX_RSQRT_ENC   AUX_ENC_RF(AUX_F7_NORM, AUX_F3_NORM_RSQRT, AUX_RD_A0, AUX_RS1_A0, AUX_RS2_X0)
+#define AUX_SQRT_ENC    AUX_ENC_RF(AUX_F7_NORM, AUX_F3_NORM_SQRT,  AUX_RD_A0, AUX_RS1_A0, AUX_RS2_X0)
+#define AUX_LOG2Q_ENC   AUX_ENC_RF(AUX_F7_LOG2Q, AUX_F3_LOG2Q, AUX_RD_A0, AUX_RS1_A0, AUX_RS2_X0)
+#define AUX_EXP2Q_ENC   AUX_ENC_RF(AUX_F7_LOG2Q, AUX_F3_EXP2Q, AUX_RD_A0, AUX_RS1_A0, AUX_RS2_X0)
+#define AUX_CIRC_ENC(F3) AUX_ENC_RF(AUX_F7_CIRC, F3, AUX_RD_A0, AUX_RS1_A0, AUX_RS2_A1)
+#define AUX_MACC16_ENC  AUX_ENC_R(AUX_F7_MACC16,  AUX_RD_A0, AUX_RS1_A1, AUX_RS2_A2)
+#define AUX_MSUBC16_ENC AUX_ENC_R(AUX_F7_MSUBC16, AUX_RD_A0, AUX_RS1_A1, AUX_RS2_A2)
+#define AUX_MIN16_ENC    AUX_ENC_RF(AUX_F7_MINMAX, AUX_F3_MIN16,    AUX_RD_A0, AUX_RS1_A0, AUX_RS2_A1)
+#define AUX_MAX16_ENC    AUX_ENC_RF(AUX_F7_MINMAX, AUX_F3_MAX16,    AUX_RD_A0, AUX_RS1_A0, AUX_RS2_A1)
+#define AUX_MAXABS16_ENC AUX_ENC_RF(AUX_F7_MINMAX, AUX_F3_MAXABS16, AUX_RD_A0, AUX_RS1_A0, AUX_RS2_A1)
+#define AUX_PEAK_ENC     AUX_ENC_RF(AUX_F7_MINMAX, AUX_F3_PEAK,     AUX_RD_A0, AUX_RS1_A0, AUX_RS2_X0)
+#define AUX_PKCFG_ENC    AUX_ENC_RF(AUX_F7_MINMAX, AUX_F3_PKCFG,    AUX_RD_A0, AUX_RS1_A0, AUX_RS2_X0)
+#define AUX_PKCLR_ENC    AUX_ENC_RF(AUX_F7_MINMAX, AUX_F3_PKCLR,    AUX_RD_A0, AUX_RS1_A0, AUX_RS2_X0)
+#define AUX_ENVF_ENC(F3) AUX_ENC_RF(AUX_F7_ENVF, F3, AUX_RD_A0, AUX_RS1_A0, AUX_RS2_A1)
+#define AUX_SINCOS_ENC AUX_ENC_RF(AUX_F7_CORDIC, AUX_F3_COR_SINCOS, AUX_RD_A0, AUX_RS1_A0, AUX_RS2_X0)
+#define AUX_ATAN2_ENC  AUX_ENC_RF(AUX_F7_CORDIC, AUX_F3_COR_ATAN2,  AUX_RD_A0, AUX_RS1_A0, AUX_RS2_X0)
+#define AUX_CMAG_ENC   AUX_ENC_RF(AUX_F7_CORDIC, AUX_F3_COR_MAG,    AUX_RD_A0, AUX_RS1_A0, AUX_RS2_X0)
+#define AUX_MED3_ENC    AUX_ENC_RF(AUX_F7_MEDIAN, AUX_F3_MED3,    AUX_RD_A0, AUX_RS1_A0, AUX_RS2_X0)
+#define AUX_MED5_ENC    AUX_ENC_RF(AUX_F7_MEDIAN, AUX_F3_MED5,    AUX_RD_A0, AUX_RS1_A0, AUX_RS2_X0)
+#define AUX_MED_CLR_ENC AUX_ENC_RF(AUX_F7_MEDIAN, AUX_F3_MED_CLR, AUX_RD_A0, AUX_RS1_A0, AUX_RS2_X0)
+#define AUX_LERP16_ENC   AUX_ENC_RF(AUX_F7_LERP16, AUX_F3_LERP16,   AUX_RD_A0, AUX_RS1_A0, AUX_RS2_A1)
+#define AUX_LERP16X2_ENC AUX_ENC_RF(AUX_F7_LERP16, AUX_F3_LERP16X2, AUX_RD_A0, AUX_RS1_A1, AUX_RS2_A2)
+#define AUX_AREG_ENC(F3, RS1, K) AUX_ENC_RF(AUX_F7_AREG, F3, AUX_RD_A0, RS1, K)
+#define AUX_SATRD_ENC  AUX_ENC_RF(AUX_F7_SATST, AUX_F3_SATRD,  AUX_RD_A0, AUX_RS1_A0, AUX_RS2_X0)
+#define AUX_SATCLR_ENC AUX_ENC_RF(AUX_F7_SATST, AUX_F3_SATCLR, AUX_RD_A0, AUX_RS1_A0, AUX_RS2_X0)
+
+/* LP.SETUP: rs1 = iteration count, {rs2, rd} = byte offset of the last
+ * loop instruction from LP.SETUP, in halfwords. */
+#define AUX_RS1_T0   5u  /* x5 / t0 */
+#define AUX_LPSETUP_ENC(RS1, END_OFS) \
+    AUX_ENC_RF(AUX_F7_LPSETUP, 0, ((END_OFS) >> 1) & 0x1f, RS1, ((END_OFS) >> 1) >> 5)
+
+/* LW.PI: rd = mem[rs1], step in the rs2 field. SW.PI: mem[rs1] = rs2,
+ * step in the rd field. STEP is a signed byte count, a multiple of 4 in
+ * -64..60. */
+#define AUX_RS1_T1   6u  /* x6 / t1 */
+#define AUX_RS1_T2   7u  /* x7 / t2 */
+#define AUX_LWPI_ENC(RD, RS1, STEP) \
+    AUX_ENC_RF(AUX_F7_LWPI, AUX_F3_PI_WORD, RD, RS1, (STEP) >> 2)
+#define AUX_SWPI_ENC(RS1, RS2, STEP) \
+    AUX_ENC_RF(AUX_F7_SWPI, AUX_F3_PI_WORD, (STEP) >> 2, RS1, RS2)
+
+/* The accumulator index is part of the encoding, so helpers taking it as
+ * an argument switch over the four encodings using these asm bodies. */
+#define AUX_ASM_RR_NOWB(ENC, A, B) \
+    __asm__ volatile ("mv a0, %0\n" "mv a1, %1\n" ".word %2\n" \
+                      : : "r"(A), "r"(B), "i"(ENC) : "a0", "a1")
+#define AUX_ASM_R_NOWB(ENC, A) \
+    __asm__ volatile ("mv a0, %0\n" ".word %1\n" \
+                      : : "r"(A), "i"(ENC) : "a0")
+#define AUX_ASM_R(RD, ENC, A) \
+    __asm__ volatile ("mv a0, %1\n" ".word %2\n" "mv %0, a0\n" \
+                      : "=r"(RD) : "r"(A), "i"(ENC) : "a0")
+#define AUX_ASM_RR(RD, ENC, A, B) \
+    __asm__ volatile ("mv a0, %1\n" "mv a1, %2\n" ".word %3\n" "mv %0, a0\n" \
+                      : "=r"(RD) : "r"(A), "r"(B), "i"(ENC) : "a0", "a1")
+#define AUX_ASM_RRR(RD, ENC, A, B, C) \
+    __asm__ volatile ("mv a0, %1\n" "mv a1, %2\n" "mv a2, %3\n" ".word %4\n" "mv %0, a0\n" \
+                      : "=r"(RD) : "r"(A), "r"(B), "r"(C), "i"(ENC) : "a0", "a1", "a2")
+
+/* The same for the audio register number of the AREG ops (16 encodings).
+ * ASM(K) is an asm body for register K. */
+#define AUX_AREG_SWITCH(K, ASM) \
+    switch ((K) & 15u) { \
+    case 0:  ASM(0);  break; case 1:  ASM(1);  break; \
+    case 2:  ASM(2);  break; case 3:  ASM(3);  break; \
+    case 4:  ASM(4);  break; case 5:  ASM(5);  break; \
+    case 6:  ASM(6);  break; case 7:  ASM(7);  break; \
+    case 8:  ASM(8);  break; case 9:  ASM(9);  break; \
+    case 10: ASM(10); break; case 11: ASM(11); break; \
+    case 12: ASM(12); break; case 13: ASM(13); break; \
+    case 14: ASM(14); break; default: ASM(15); break; \
+    }
 
 uint32_t aux_mac16(uint32_t a, uint32_t b)
 {
@@ -129,20 +371,111 @@ uint32_t aux_conv8(uint32_t x_packed, uint32_t h_packed)
     return rd;
 }
 
-uint32_t aux_lmsstep(uint32_t x_packed, uint32_t h_packed)
+uint32_t aux_conv8_seth(uint32_t h_hi_packed)
+{
+    uint32_t rd;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        ".word %2\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(h_hi_packed), "i"(AUX_CONV8_SETH_ENC)
+        : "a0");
+    return rd;
+}
+
+uint32_t aux_conv8_push(uint32_t x, uint32_t h_packed)
+{
+    uint32_t rd;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        "mv a1, %2\n"
+        ".word %3\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(x), "r"(h_packed), "i"(AUX_CONV8_PUSH_ENC)
+        : "a0", "a1");
+    return rd;
+}
+
+void aux_conv8_clr(void)
+{
+    __asm__ volatile (
+        ".word %0\n"
+        :
+        : "i"(AUX_CONV8_CLR_ENC)
+        : "a0");
+}
+
+uint32_t aux_lmsstep(int16_t x, int16_t d)
+{
+    uint32_t rd;
+    uint32_t x_bits = (uint16_t)x;
+    uint32_t d_bits = (uint16_t)d;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        "mv a1, %2\n"
+        ".word %3\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(x_bits), "r"(d_bits), "i"(AUX_LMSSTEP_ENC)
+        : "a0", "a1");
+    return rd;
+}
+
+int16_t aux_lms_setc(uint32_t idx, int16_t c)
+{
+    uint32_t rd;
+    uint32_t c_bits = (uint16_t)c;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        "mv a1, %2\n"
+        ".word %3\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(idx), "r"(c_bits), "i"(AUX_LMS_SETC_ENC)
+        : "a0", "a1");
+    return (int16_t)rd;
+}
+
+int16_t aux_lms_getc(uint32_t idx)
+{
+    uint32_t rd;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        ".word %2\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(idx), "i"(AUX_LMS_GETC_ENC)
+        : "a0");
+    return (int16_t)rd;
+}
+
+uint32_t aux_lms_cfg(int16_t mu, uint32_t shift, uint32_t taps)
 {
     uint32_t rd;
+    uint32_t mu_bits = (uint16_t)mu;
+    uint32_t cfg = (shift & 0x1fu) | ((taps & 0x7fu) << 8);
     __asm__ volatile (
         "mv a0, %1\n"
         "mv a1, %2\n"
         ".word %3\n"
         "mv %0, a0\n"
         : "=r"(rd)
-        : "r"(x_packed), "r"(h_packed), "i"(AUX_LMSSTEP_ENC)
+        : "r"(mu_bits), "r"(cfg), "i"(AUX_LMS_CFG_ENC)
         : "a0", "a1");
     return rd;
 }
 
+void aux_lms_clr(void)
+{
+    __asm__ volatile (
+        ".word %0\n"
+        :
+        : "i"(AUX_LMS_CLR_ENC)
+        : "a0");
+}
+
 uint32_t aux_cmac(uint32_t x_complex, uint32_t h_complex)
 {
     uint32_t rd;
@@ -186,3 +519,994 @@ uint32_t aux_shiftn(uint32_t x, uint32_t shamt)
     return rd;
 }
 
+/* SHIFTN with an explicit rounding mode (AUX_SHN_* in aux.h). */
+uint32_t aux_shiftn_rm(uint32_t x, uint32_t shamt, uint32_t mode)
+{
+    uint32_t rd;
+    switch (mode) {
+    case AUX_SHN_TRUNC: AUX_ASM_RR(rd, AUX_SHIFTN_RM_ENC(AUX_F3_SHN_TRUNC), x, shamt); break;
+    case AUX_SHN_EVEN:  AUX_ASM_RR(rd, AUX_SHIFTN_RM_ENC(AUX_F3_SHN_EVEN), x, shamt); break;
+    default:            AUX_ASM_RR(rd, AUX_SHIFTN_RM_ENC(AUX_F3_SHN_AWAY), x, shamt); break;
+    }
+    return rd;
+}
+
+/* 64-bit SHIFTN: x >>> ctrl[5:0], rounded, saturated to 32 bits or, with
+ * AUX_SHN_NARROW in ctrl, to 16 bits. Narrows a Q31 product sum to Q15
+ * in one instruction. */
+int32_t aux_shiftn64(int64_t x, uint32_t ctrl, uint32_t mode)
+{
+    uint32_t rd;
+    uint32_t lo = (uint32_t)x;
+    uint32_t hi = (uint32_t)((uint64_t)x >> 32);
+    switch (mode) {
+    case AUX_SHN_TRUNC: AUX_ASM_RRR(rd, AUX_SHIFTN64_ENC(AUX_F3_SHN_TRUNC), ctrl, lo, hi); break;
+    case AUX_SHN_EVEN:  AUX_ASM_RRR(rd, AUX_SHIFTN64_ENC(AUX_F3_SHN_EVEN), ctrl, lo, hi); break;
+    default:            AUX_ASM_RRR(rd, AUX_SHIFTN64_ENC(AUX_F3_SHN_AWAY), ctrl, lo, hi); break;
+    }
+    return (int32_t)rd;
+}
+
+void aux_maca(uint32_t acc, uint32_t a, uint32_t b)
+{
+    switch (acc & 3u) {
+    case 0:  AUX_ASM_RR_NOWB(AUX_MACA_ENC(0), a, b); break;
+    case 1:  AUX_ASM_RR_NOWB(AUX_MACA_ENC(1), a, b); break;
+    case 2:  AUX_ASM_RR_NOWB(AUX_MACA_ENC(2), a, b); break;
+    default: AUX_ASM_RR_NOWB(AUX_MACA_ENC(3), a, b); break;
+    }
+}
+
+void aux_maca8(uint32_t acc, uint32_t x_packed, uint32_t h_packed)
+{
+    switch (acc & 3u) {
+    case 0:  AUX_ASM_RR_NOWB(AUX_MACA_ENC(AUX_F3_ACC_ALT | 0), x_packed, h_packed); break;
+    case 1:  AUX_ASM_RR_NOWB(AUX_MACA_ENC(AUX_F3_ACC_ALT | 1), x_packed, h_packed); break;
+    case 2:  AUX_ASM_RR_NOWB(AUX_MACA_ENC(AUX_F3_ACC_ALT | 2), x_packed, h_packed); break;
+    default: AUX_ASM_RR_NOWB(AUX_MACA_ENC(AUX_F3_ACC_ALT | 3), x_packed, h_packed); break;
+    }
+}
+
+int32_t aux_accrd(uint32_t acc, uint32_t shamt)
+{
+    uint32_t rd;
+    switch (acc & 3u) {
+    case 0:  AUX_ASM_R(rd, AUX_ACCRD_ENC(0), shamt); break;
+    case 1:  AUX_ASM_R(rd, AUX_ACCRD_ENC(1), shamt); break;
+    case 2:  AUX_ASM_R(rd, AUX_ACCRD_ENC(2), shamt); break;
+    default: AUX_ASM_R(rd, AUX_ACCRD_ENC(3), shamt); break;
+    }
+    return (int32_t)rd;
+}
+
+int16_t aux_accrd16(uint32_t acc, uint32_t shamt)
+{
+    uint32_t rd;
+    switch (acc & 3u) {
+    case 0:  AUX_ASM_R(rd, AUX_ACCRD_ENC(AUX_F3_ACC_ALT | 0), shamt); break;
+    case 1:  AUX_ASM_R(rd, AUX_ACCRD_ENC(AUX_F3_ACC_ALT | 1), shamt); break;
+    case 2:  AUX_ASM_R(rd, AUX_ACCRD_ENC(AUX_F3_ACC_ALT | 2), shamt); break;
+    default: AUX_ASM_R(rd, AUX_ACCRD_ENC(AUX_F3_ACC_ALT | 3), shamt); break;
+    }
+    return (int16_t)rd;
+}
+
+void aux_accclr(uint32_t acc)
+{
+    switch (acc & 3u) {
+    case 0:  AUX_ASM_R_NOWB(AUX_ACCCLR_ENC(0), 0u); break;
+    case 1:  AUX_ASM_R_NOWB(AUX_ACCCLR_ENC(1), 0u); break;
+    case 2:  AUX_ASM_R_NOWB(AUX_ACCCLR_ENC(2), 0u); break;
+    default: AUX_ASM_R_NOWB(AUX_ACCCLR_ENC(3), 0u); break;
+    }
+}
+
+void aux_accset(uint32_t acc, int32_t v)
+{
+    uint32_t v_bits = (uint32_t)v;
+    switch (acc & 3u) {
+    case 0:  AUX_ASM_R_NOWB(AUX_ACCCLR_ENC(AUX_F3_ACC_ALT | 0), v_bits); break;
+    case 1:  AUX_ASM_R_NOWB(AUX_ACCCLR_ENC(AUX_F3_ACC_ALT | 1), v_bits); break;
+    case 2:  AUX_ASM_R_NOWB(AUX_ACCCLR_ENC(AUX_F3_ACC_ALT | 2), v_bits); break;
+    default: AUX_ASM_R_NOWB(AUX_ACCCLR_ENC(AUX_F3_ACC_ALT | 3), v_bits); break;
+    }
+}
+
+int16_t aux_bq_step(uint32_t sec, int16_t x)
+{
+    uint32_t rd;
+    uint32_t x_bits = (uint16_t)x;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        "mv a1, %2\n"
+        ".word %3\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(x_bits), "r"(sec), "i"(AUX_BQ_STEP_ENC)
+        : "a0", "a1");
+    return (int16_t)rd;
+}
+
+int16_t aux_bq_setc(uint32_t sec, uint32_t k, int16_t c)
+{
+    uint32_t rd;
+    uint32_t idx = ((sec & 3u) << 3) | (k & 7u);
+    uint32_t c_bits = (uint16_t)c;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        "mv a1, %2\n"
+        ".word %3\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(idx), "r"(c_bits), "i"(AUX_BQ_SETC_ENC)
+        : "a0", "a1");
+    return (int16_t)rd;
+}
+
+void aux_bq_set(uint32_t sec, int16_t b0, int16_t b1, int16_t b2, int16_t a1, int16_t a2)
+{
+    (void)aux_bq_setc(sec, 0u, b0);
+    (void)aux_bq_setc(sec, 1u, b1);
+    (void)aux_bq_setc(sec, 2u, b2);
+    (void)aux_bq_setc(sec, 3u, a1);
+    (void)aux_bq_setc(sec, 4u, a2);
+}
+
+void aux_bq_clr(void)
+{
+    __asm__ volatile (
+        ".word %0\n"
+        :
+        : "i"(AUX_BQ_CLR_ENC)
+        : "a0");
+}
+
+uint32_t aux_bfly_tw(uint32_t w_complex)
+{
+    uint32_t rd;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        ".word %2\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(w_complex), "i"(AUX_BFLY_TW_ENC)
+        : "a0");
+    return rd;
+}
+
+uint32_t aux_bfly_twk(uint32_t k)
+{
+    uint32_t rd;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        ".word %2\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(k), "i"(AUX_BFLY_TWK_ENC)
+        : "a0");
+    return rd;
+}
+
+uint32_t aux_bfly(uint32_t a, uint32_t b)
+{
+    uint32_t rd;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        "mv a1, %2\n"
+        ".word %3\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(a), "r"(b), "i"(AUX_BFLY_ENC)
+        : "a0", "a1");
+    return rd;
+}
+
+uint32_t aux_bfly_scale(uint32_t a, uint32_t b)
+{
+    uint32_t rd;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        "mv a1, %2\n"
+        ".word %3\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(a), "r"(b), "i"(AUX_BFLY_SCALE_ENC)
+        : "a0", "a1");
+    return rd;
+}
+
+uint32_t aux_bfly_diff(void)
+{
+    uint32_t rd;
+    __asm__ volatile (
+        ".word %1\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "i"(AUX_BFLY_DIFF_ENC)
+        : "a0");
+    return rd;
+}
+
+uint32_t aux_add16s(uint32_t a, uint32_t b)
+{
+    uint32_t rd;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        "mv a1, %2\n"
+        ".word %3\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(a), "r"(b), "i"(AUX_ADD16S_ENC)
+        : "a0", "a1");
+    return rd;
+}
+
+uint32_t aux_sub16s(uint32_t a, uint32_t b)
+{
+    uint32_t rd;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        "mv a1, %2\n"
+        ".word %3\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(a), "r"(b), "i"(AUX_SUB16S_ENC)
+        : "a0", "a1");
+    return rd;
+}
+
+uint32_t aux_pklo(uint32_t lo, uint32_t hi)
+{
+    uint32_t rd;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        "mv a1, %2\n"
+        ".word %3\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(lo), "r"(hi), "i"(AUX_PKLO_ENC)
+        : "a0", "a1");
+    return rd;
+}
+
+uint32_t aux_pkhi(uint32_t lo, uint32_t hi)
+{
+    uint32_t rd;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        "mv a1, %2\n"
+        ".word %3\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(lo), "r"(hi), "i"(AUX_PKHI_ENC)
+        : "a0", "a1");
+    return rd;
+}
+
+int32_t aux_sxtlo(uint32_t x)
+{
+    uint32_t rd;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        ".word %2\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(x), "i"(AUX_SXTLO_ENC)
+        : "a0");
+    return (int32_t)rd;
+}
+
+int32_t aux_sxthi(uint32_t x)
+{
+    uint32_t rd;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        ".word %2\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(x), "i"(AUX_SXTHI_ENC)
+        : "a0");
+    return (int32_t)rd;
+}
+
+uint32_t aux_mulq15(uint32_t a, uint32_t b)
+{
+    uint32_t rd;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        "mv a1, %2\n"
+        ".word %3\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(a), "r"(b), "i"(AUX_MULQ15_ENC)
+        : "a0", "a1");
+    return rd;
+}
+
+uint32_t aux_mulq15r(uint32_t a, uint32_t b)
+{
+    uint32_t rd;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        "mv a1, %2\n"
+        ".word %3\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(a), "r"(b), "i"(AUX_MULQ15R_ENC)
+        : "a0", "a1");
+    return rd;
+}
+
+uint32_t aux_recip(uint32_t x_q15)
+{
+    uint32_t rd;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        ".word %2\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(x_q15), "i"(AUX_RECIP_ENC)
+        : "a0");
+    return rd;
+}
+
+uint32_t aux_rsqrt(uint32_t x_q15)
+{
+    uint32_t rd;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        ".word %2\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(x_q15), "i"(AUX_RSQRT_ENC)
+        : "a0");
+    return rd;
+}
+
+uint32_t aux_sqrt(uint32_t x_q15)
+{
+    uint32_t rd;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        ".word %2\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(x_q15), "i"(AUX_SQRT_ENC)
+        : "a0");
+    return rd;
+}
+
+int32_t aux_log2q(uint32_t x)
+{
+    uint32_t rd;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        ".word %2\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(x), "i"(AUX_LOG2Q_ENC)
+        : "a0");
+    return (int32_t)rd;
+}
+
+uint32_t aux_exp2q(int16_t y_q8_8)
+{
+    uint32_t rd;
+    uint32_t y_bits = (uint16_t)y_q8_8;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        ".word %2\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(y_bits), "i"(AUX_EXP2Q_ENC)
+        : "a0");
+    return rd;
+}
+
+uint32_t aux_circ_setb(uint32_t p, uint32_t base)
+{
+    uint32_t rd;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        "mv a1, %2\n"
+        ".word %3\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(base), "r"(p), "i"(AUX_CIRC_ENC(AUX_F3_CIRC_SETB))
+        : "a0", "a1");
+    return rd;
+}
+
+void aux_circ_setl(uint32_t p, uint32_t len, uint32_t esz)
+{
+    uint32_t cfg = (len & 0xffffu) | ((esz & 3u) << 16);
+    __asm__ volatile (
+        "mv a0, %0\n"
+        "mv a1, %1\n"
+        ".word %2\n"
+        :
+        : "r"(cfg), "r"(p), "i"(AUX_CIRC_ENC(AUX_F3_CIRC_SETL))
+        : "a0", "a1");
+}
+
+uint32_t aux_circ_next(uint32_t p, int32_t step)
+{
+    uint32_t rd;
+    uint32_t step_bits = (uint32_t)step;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        "mv a1, %2\n"
+        ".word %3\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(step_bits), "r"(p), "i"(AUX_CIRC_ENC(AUX_F3_CIRC_NEXT))
+        : "a0", "a1");
+    return rd;
+}
+
+uint32_t aux_circ_addr(uint32_t p, int32_t offset)
+{
+    uint32_t rd;
+    uint32_t off_bits = (uint32_t)offset;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        "mv a1, %2\n"
+        ".word %3\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(off_bits), "r"(p), "i"(AUX_CIRC_ENC(AUX_F3_CIRC_ADDR))
+        : "a0", "a1");
+    return rd;
+}
+
+uint32_t aux_circ_geti(uint32_t p)
+{
+    uint32_t rd;
+    __asm__ volatile (
+        "mv a1, %1\n"
+        ".word %2\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(p), "i"(AUX_CIRC_ENC(AUX_F3_CIRC_GETI))
+        : "a0", "a1");
+    return rd;
+}
+
+uint32_t aux_circ_seti(uint32_t p, uint32_t idx)
+{
+    uint32_t rd;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        "mv a1, %2\n"
+        ".word %3\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(idx), "r"(p), "i"(AUX_CIRC_ENC(AUX_F3_CIRC_SETI))
+        : "a0", "a1");
+    return rd;
+}
+
+int32_t aux_macc16(int32_t acc, uint32_t a, uint32_t b)
+{
+    uint32_t rd;
+    uint32_t acc_bits = (uint32_t)acc;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        "mv a1, %2\n"
+        "mv a2, %3\n"
+        ".word %4\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(acc_bits), "r"(a), "r"(b), "i"(AUX_MACC16_ENC)
+        : "a0", "a1", "a2");
+    return (int32_t)rd;
+}
+
+int32_t aux_msubc16(int32_t acc, uint32_t a, uint32_t b)
+{
+    uint32_t rd;
+    uint32_t acc_bits = (uint32_t)acc;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        "mv a1, %2\n"
+        "mv a2, %3\n"
+        ".word %4\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(acc_bits), "r"(a), "r"(b), "i"(AUX_MSUBC16_ENC)
+        : "a0", "a1", "a2");
+    return (int32_t)rd;
+}
+
+uint32_t aux_min16(uint32_t a, uint32_t b)
+{
+    uint32_t rd;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        "mv a1, %2\n"
+        ".word %3\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(a), "r"(b), "i"(AUX_MIN16_ENC)
+        : "a0", "a1");
+    return rd;
+}
+
+uint32_t aux_max16(uint32_t a, uint32_t b)
+{
+    uint32_t rd;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        "mv a1, %2\n"
+        ".word %3\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(a), "r"(b), "i"(AUX_MAX16_ENC)
+        : "a0", "a1");
+    return rd;
+}
+
+uint32_t aux_maxabs16(uint32_t a, uint32_t b)
+{
+    uint32_t rd;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        "mv a1, %2\n"
+        ".word %3\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(a), "r"(b), "i"(AUX_MAXABS16_ENC)
+        : "a0", "a1");
+    return rd;
+}
+
+uint32_t aux_peakhold(uint32_t x)
+{
+    uint32_t rd;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        ".word %2\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(x), "i"(AUX_PEAK_ENC)
+        : "a0");
+    return rd;
+}
+
+uint32_t aux_pk_cfg(uint32_t decay_shift)
+{
+    uint32_t rd;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        ".word %2\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(decay_shift), "i"(AUX_PKCFG_ENC)
+        : "a0");
+    return rd;
+}
+
+void aux_pk_clr(void)
+{
+    __asm__ volatile (
+        ".word %0\n"
+        :
+        : "i"(AUX_PKCLR_ENC)
+        : "a0");
+}
+
+uint32_t aux_envf(uint32_t ch, uint32_t level)
+{
+    uint32_t rd;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        "mv a1, %2\n"
+        ".word %3\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(level), "r"(ch), "i"(AUX_ENVF_ENC(AUX_F3_ENVF_LVL))
+        : "a0", "a1");
+    return rd;
+}
+
+uint32_t aux_envf_abs(uint32_t ch, int16_t x)
+{
+    uint32_t rd;
+    uint32_t x_bits = (uint16_t)x;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        "mv a1, %2\n"
+        ".word %3\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(x_bits), "r"(ch), "i"(AUX_ENVF_ENC(AUX_F3_ENVF_ABS))
+        : "a0", "a1");
+    return rd;
+}
+
+uint32_t aux_envf_sq(uint32_t ch, int16_t x)
+{
+    uint32_t rd;
+    uint32_t x_bits = (uint16_t)x;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        "mv a1, %2\n"
+        ".word %3\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(x_bits), "r"(ch), "i"(AUX_ENVF_ENC(AUX_F3_ENVF_SQ))
+        : "a0", "a1");
+    return rd;
+}
+
+uint32_t aux_envf_cfg(uint32_t ch, uint32_t attack_shift, uint32_t release_shift)
+{
+    uint32_t rd;
+    uint32_t cfg = (attack_shift & 0x1fu) | ((release_shift & 0x1fu) << 8);
+    __asm__ volatile (
+        "mv a0, %1\n"
+        "mv a1, %2\n"
+        ".word %3\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(cfg), "r"(ch), "i"(AUX_ENVF_ENC(AUX_F3_ENVF_CFG))
+        : "a0", "a1");
+    return rd;
+}
+
+uint32_t aux_envf_set(uint32_t ch, uint32_t env)
+{
+    uint32_t rd;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        "mv a1, %2\n"
+        ".word %3\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(env), "r"(ch), "i"(AUX_ENVF_ENC(AUX_F3_ENVF_SET))
+        : "a0", "a1");
+    return rd;
+}
+
+uint32_t aux_sincos(int16_t phase_q15)
+{
+    uint32_t rd;
+    uint32_t ph_bits = (uint16_t)phase_q15;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        ".word %2\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(ph_bits), "i"(AUX_SINCOS_ENC)
+        : "a0");
+    return rd;
+}
+
+int16_t aux_atan2(uint32_t x_complex)
+{
+    uint32_t rd;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        ".word %2\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(x_complex), "i"(AUX_ATAN2_ENC)
+        : "a0");
+    return (int16_t)rd;
+}
+
+uint32_t aux_cmag(uint32_t x_complex)
+{
+    uint32_t rd;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        ".word %2\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(x_complex), "i"(AUX_CMAG_ENC)
+        : "a0");
+    return rd;
+}
+
+int16_t aux_med3(int16_t x)
+{
+    uint32_t rd;
+    uint32_t x_bits = (uint16_t)x;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        ".word %2\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(x_bits), "i"(AUX_MED3_ENC)
+        : "a0");
+    return (int16_t)rd;
+}
+
+int16_t aux_med5(int16_t x)
+{
+    uint32_t rd;
+    uint32_t x_bits = (uint16_t)x;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        ".word %2\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(x_bits), "i"(AUX_MED5_ENC)
+        : "a0");
+    return (int16_t)rd;
+}
+
+void aux_med_clr(void)
+{
+    __asm__ volatile (
+        ".word %0\n"
+        :
+        : "i"(AUX_MED_CLR_ENC)
+        : "a0");
+}
+
+int16_t aux_lerp16(uint32_t ba, uint32_t frac_q15)
+{
+    uint32_t rd;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        "mv a1, %2\n"
+        ".word %3\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(ba), "r"(frac_q15), "i"(AUX_LERP16_ENC)
+        : "a0", "a1");
+    return (int16_t)rd;
+}
+
+/* frac travels in a0, which is also rd (see MACC16). */
+uint32_t aux_lerp16x2(uint32_t a, uint32_t b, uint32_t frac_q15)
+{
+    uint32_t rd;
+    __asm__ volatile (
+        "mv a0, %1\n"
+        "mv a1, %2\n"
+        "mv a2, %3\n"
+        ".word %4\n"
+        "mv %0, a0\n"
+        : "=r"(rd)
+        : "r"(frac_q15), "r"(a), "r"(b), "i"(AUX_LERP16X2_ENC)
+        : "a0", "a1", "a2");
+    return rd;
+}
+
+uint32_t aux_arw(uint32_t k, uint32_t v)
+{
+    uint32_t rd;
+#define AUX_ARW_K(K) AUX_ASM_R(rd, AUX_AREG_ENC(AUX_F3_ARW, AUX_RS1_A0, K), v)
+    AUX_AREG_SWITCH(k, AUX_ARW_K)
+#undef AUX_ARW_K
+    return rd;
+}
+
+uint32_t aux_arr(uint32_t k)
+{
+    uint32_t rd;
+#define AUX_ARR_K(K) AUX_ASM_R(rd, AUX_AREG_ENC(AUX_F3_ARR, AUX_RS1_A0, K), 0u)
+    AUX_AREG_SWITCH(k, AUX_ARR_K)
+#undef AUX_ARR_K
+    return rd;
+}
+
+uint32_t aux_mac16a(uint32_t x, uint32_t k)
+{
+    uint32_t rd;
+#define AUX_MAC16A_K(K) AUX_ASM_R(rd, AUX_AREG_ENC(AUX_F3_MAC16A, AUX_RS1_A0, K), x)
+    AUX_AREG_SWITCH(k, AUX_MAC16A_K)
+#undef AUX_MAC16A_K
+    return rd;
+}
+
+int32_t aux_macc16a(int32_t acc, uint32_t x, uint32_t k)
+{
+    uint32_t rd;
+    uint32_t acc_bits = (uint32_t)acc;
+#define AUX_MACC16A_K(K) AUX_ASM_RR(rd, AUX_AREG_ENC(AUX_F3_MACC16A, AUX_RS1_A1, K), acc_bits, x)
+    AUX_AREG_SWITCH(k, AUX_MACC16A_K)
+#undef AUX_MACC16A_K
+    return (int32_t)rd;
+}
+
+uint32_t aux_mulq15ra(uint32_t x, uint32_t k)
+{
+    uint32_t rd;
+#define AUX_MULQ15A_K(K) AUX_ASM_R(rd, AUX_AREG_ENC(AUX_F3_MULQ15A, AUX_RS1_A0, K), x)
+    AUX_AREG_SWITCH(k, AUX_MULQ15A_K)
+#undef AUX_MULQ15A_K
+    return rd;
+}
+
+uint32_t aux_conv4a(uint32_t x_packed, uint32_t k)
+{
+    uint32_t rd;
+#define AUX_CONV4A_K(K) AUX_ASM_R(rd, AUX_AREG_ENC(AUX_F3_CONV4A, AUX_RS1_A0, K), x_packed)
+    AUX_AREG_SWITCH(k, AUX_CONV4A_K)
+#undef AUX_CONV4A_K
+    return rd;
+}
+
+/* 16-tap FIR on eight packed sample pairs x[0..7] with the coefficient
+ * pairs held in audio registers 0..7 (set once with aux_arw): one load
+ * and one MACC16.A per pair, no coefficient loads and no extra integer
+ * registers. */
+int32_t aux_fir16_areg(const uint32_t *x)
+{
+    uint32_t acc;
+    __asm__ volatile (
+        "li a0, 0\n"
+        "lw a1, 0(%1)\n"  ".word %2\n"
+        "lw a1, 4(%1)\n"  ".word %3\n"
+        "lw a1, 8(%1)\n"  ".word %4\n"
+        "lw a1, 12(%1)\n" ".word %5\n"
+        "lw a1, 16(%1)\n" ".word %6\n"
+        "lw a1, 20(%1)\n" ".word %7\n"
+        "lw a1, 24(%1)\n" ".word %8\n"
+        "lw a1, 28(%1)\n" ".word %9\n"
+        "mv %0, a0\n"
+        : "=r"(acc)
+        : "r"(x),
+          "i"(AUX_AREG_ENC(AUX_F3_MACC16A, AUX_RS1_A1, 0)), "i"(AUX_AREG_ENC(AUX_F3_MACC16A, AUX_RS1_A1, 1)),
+          "i"(AUX_AREG_ENC(AUX_F3_MACC16A, AUX_RS1_A1, 2)), "i"(AUX_AREG_ENC(AUX_F3_MACC16A, AUX_RS1_A1, 3)),
+          "i"(AUX_AREG_ENC(AUX_F3_MACC16A, AUX_RS1_A1, 4)), "i"(AUX_AREG_ENC(AUX_F3_MACC16A, AUX_RS1_A1, 5)),
+          "i"(AUX_AREG_ENC(AUX_F3_MACC16A, AUX_RS1_A1, 6)), "i"(AUX_AREG_ENC(AUX_F3_MACC16A, AUX_RS1_A1, 7))
+        : "a0", "a1", "memory");
+    return (int32_t)acc;
+}
+
+/* Sticky saturation flags (AUX_SAT_* in aux.h). SATCLR clears the bits
+ * set in mask; both return the flags as they were before. */
+uint32_t aux_sat_status(void)
+{
+    uint32_t rd;
+    AUX_ASM_R(rd, AUX_SATRD_ENC, 0u);
+    return rd;
+}
+
+uint32_t aux_sat_clear(uint32_t mask)
+{
+    uint32_t rd;
+    AUX_ASM_R(rd, AUX_SATCLR_ENC, mask);
+    return rd;
+}
+
+/* Load one packed sample pair and advance *p by one word (LW.PI). */
+uint32_t aux_lw_pi(const uint32_t **p)
+{
+    uint32_t rd;
+    const uint32_t *ptr = *p;
+    __asm__ volatile ("mv t1, %1\n" ".word %2\n" "mv %0, a0\n" "mv %1, t1\n"
+                      : "=r"(rd), "+r"(ptr)
+                      : "i"(AUX_LWPI_ENC(AUX_RD_A0, AUX_RS1_T1, 4))
+                      : "a0", "t1", "memory");
+    *p = ptr;
+    return rd;
+}
+
+/* Store one packed sample pair and advance *p by one word (SW.PI). */
+void aux_sw_pi(uint32_t **p, uint32_t v)
+{
+    uint32_t *ptr = *p;
+    __asm__ volatile ("mv t1, %0\n" "mv a1, %1\n" ".word %2\n" "mv %0, t1\n"
+                      : "+r"(ptr)
+                      : "r"(v), "i"(AUX_SWPI_ENC(AUX_RS1_T1, AUX_RS2_A1, 4))
+                      : "a1", "t1", "memory");
+    *p = ptr;
+}
+
+/* Dot product of packed 16-bit pairs, accumulated in a0 with MACC16. The
+ * two versions run the same body; aux_dot16 uses a hardware loop,
+ * aux_dot16_branch the usual counter decrement and branch. Compressed
+ * encodings are disabled so the LP.SETUP end offset (20 bytes) stays
+ * fixed. */
+int32_t aux_dot16(const uint32_t *x, const uint32_t *h, uint32_t pairs)
+{
+    uint32_t acc;
+    if (pairs == 0)
+        return 0;
+    __asm__ volatile (
+        ".option push\n"
+        ".option norvc\n"
+        "li a0, 0\n"
+        "mv t0, %3\n"
+        ".word %4\n"
+        "lw a1, 0(%1)\n"
+        "lw a2, 0(%2)\n"
+        ".word %5\n"
+        "addi %1, %1, 4\n"
+        "addi %2, %2, 4\n"
+        ".option pop\n"
+        "mv %0, a0\n"
+        : "=r"(acc), "+r"(x), "+r"(h)
+        : "r"(pairs), "i"(AUX_LPSETUP_ENC(AUX_RS1_T0, 20)), "i"(AUX_MACC16_ENC)
+        : "t0", "a0", "a1", "a2", "memory");
+    return (int32_t)acc;
+}
+
+int32_t aux_dot16_branch(const uint32_t *x, const uint32_t *h, uint32_t pairs)
+{
+    uint32_t acc;
+    if (pairs == 0)
+        return 0;
+    __asm__ volatile (
+        ".option push\n"
+        ".option norvc\n"
+        "li a0, 0\n"
+        "mv t0, %3\n"
+        "1:\n"
+        "lw a1, 0(%1)\n"
+        "lw a2, 0(%2)\n"
+        ".word %4\n"
+        "addi %1, %1, 4\n"
+        "addi %2, %2, 4\n"
+        "addi t0, t0, -1\n"
+        "bnez t0, 1b\n"
+        ".option pop\n"
+        "mv %0, a0\n"
+        : "=r"(acc), "+r"(x), "+r"(h)
+        : "r"(pairs), "i"(AUX_MACC16_ENC)
+        : "t0", "a0", "a1", "a2", "memory");
+    return (int32_t)acc;
+}
+
+/* aux_dot16 with post-increment loads: the loop body shrinks to two
+ * LW.PI and one MACC16 (LP.SETUP end offset 12 bytes). */
+int32_t aux_dot16_pi(const uint32_t *x, const uint32_t *h, uint32_t pairs)
+{
+    uint32_t acc;
+    if (pairs == 0)
+        return 0;
+    __asm__ volatile (
+        ".option push\n"
+        ".option norvc\n"
+        "li a0, 0\n"
+        "mv t0, %3\n"
+        "mv t1, %1\n"
+        "mv t2, %2\n"
+        ".word %4\n"
+        ".word %5\n"
+        ".word %6\n"
+        ".word %7\n"
+        ".option pop\n"
+        "mv %0, a0\n"
+        : "=r"(acc)
+        : "r"(x), "r"(h), "r"(pairs), "i"(AUX_LPSETUP_ENC(AUX_RS1_T0, 12)),
+          "i"(AUX_LWPI_ENC(AUX_RS2_A1, AUX_RS1_T1, 4)), "i"(AUX_LWPI_ENC(AUX_RS2_A2, AUX_RS1_T2, 4)),
+          "i"(AUX_MACC16_ENC)
+        : "t0", "t1", "t2", "a0", "a1", "a2", "memory");
+    return (int32_t)acc;
+}
+
+/* rdcycle delta around eight back-to-back instances of one instruction,
+ * operands in a0/a1. Used by main() to report CPI per AUX op. */
+#define AUX_CYCLES8(T0, T1, ENC) \
+    __asm__ volatile ("li a0, 0x00030001\n" "li a1, 0x00020005\n" \
+                      "rdcycle %0\n" ".rept 8\n" ".word %2\n" ".endr\n" "rdcycle %1\n" \
+                      : "=&r"(T0), "=r"(T1) : "i"(ENC) : "a0", "a1")
+
+uint32_t aux_cycles8(uint32_t op)
+{
+    uint32_t t0, t1;
+    switch (op) {
+    case AUX_CPI_MAC16:  AUX_CYCLES8(t0, t1, AUX_MAC16_ENC);  break;
+    case AUX_CPI_ABS16:  AUX_CYCLES8(t0, t1, AUX_ABS16_ENC);  break;
+    case AUX_CPI_CONV4:  AUX_CYCLES8(t0, t1, AUX_CONV4_ENC);  break;
+    case AUX_CPI_CMAC:   AUX_CYCLES8(t0, t1, AUX_CMAC_ENC);   break;
+    case AUX_CPI_SHIFTN: AUX_CYCLES8(t0, t1, AUX_SHIFTN_ENC); break;
+    case AUX_CPI_ADD16S: AUX_CYCLES8(t0, t1, AUX_ADD16S_ENC); break;
+    case AUX_CPI_MIN16:  AUX_CYCLES8(t0, t1, AUX_MIN16_ENC);  break;
+    case AUX_CPI_MULQ15: AUX_CYCLES8(t0, t1, AUX_MULQ15_ENC); break;
+    default:
+        __asm__ volatile ("li a0, 0x00030001\n" "li a1, 0x00020005\n"
+                          "rdcycle %0\n" ".option push\n" ".option norvc\n"
+                          ".rept 8\n" "add a0, a0, a1\n" ".endr\n" ".option pop\n" "rdcycle %1\n"
+                          : "=&r"(t0), "=r"(t1) : : "a0", "a1");
+        break;
+    }
+    return t1 - t0;
+}
+
@@ -9,10 +9,125 @@ uint32_t aux_abs16(uint32_t x);
 uint32_t aux_abs2(uint32_t x);
 uint32_t aux_conv4(uint32_t x_packed, uint32_t h_packed);
 uint32_t aux_conv8(uint32_t x_packed, uint32_t h_packed);
-uint32_t aux_lmsstep(uint32_t x_packed, uint32_t h_packed);
+uint32_t aux_conv8_seth(uint32_t h_hi_packed);
+uint32_t aux_conv8_push(uint32_t x, uint32_t h_packed);
+void aux_conv8_clr(void);
+uint32_t aux_lmsstep(int16_t x, int16_t d);
+int16_t aux_lms_setc(uint32_t idx, int16_t c);
+int16_t aux_lms_getc(uint32_t idx);
+uint32_t aux_lms_cfg(int16_t mu, uint32_t shift, uint32_t taps);
+void aux_lms_clr(void);
 uint32_t aux_cmac(uint32_t x_complex, uint32_t h_complex);
 uint32_t aux_clip16(uint32_t x, int16_t limit);
+uint32_t aux_add16s(uint32_t a, uint32_t b);
+uint32_t aux_sub16s(uint32_t a, uint32_t b);
+uint32_t aux_pklo(uint32_t lo, uint32_t hi);
+uint32_t aux_pkhi(uint32_t lo, uint32_t hi);
+int32_t aux_sxtlo(uint32_t x);
+int32_t aux_sxthi(uint32_t x);
+uint32_t aux_mulq15(uint32_t a, uint32_t b);
+uint32_t aux_mulq15r(uint32_t a, uint32_t b);
+uint32_t aux_recip(uint32_t x_q15);
+uint32_t aux_rsqrt(uint32_t x_q15);
+uint32_t aux_sqrt(uint32_t x_q15);
+int32_t aux_log2q(uint32_t x);
+uint32_t aux_exp2q(int16_t y_q8_8);
+uint32_t aux_circ_setb(uint32_t p, uint32_t base);
+void aux_circ_setl(uint32_t p, uint32_t len, uint32_t esz);
+uint32_t aux_circ_next(uint32_t p, int32_t step);
+uint32_t aux_circ_addr(uint32_t p, int32_t offset);
+uint32_t aux_circ_geti(uint32_t p);
+uint32_t aux_circ_seti(uint32_t p, uint32_t idx);
 uint32_t aux_shiftn(uint32_t x, uint32_t shamt);
+uint32_t aux_shiftn_rm(uint32_t x, uint32_t shamt, uint32_t mode);
+int32_t aux_shiftn64(int64_t x, uint32_t ctrl, uint32_t mode);
+void aux_maca(uint32_t acc, uint32_t a, uint32_t b);
+void aux_maca8(uint32_t acc, uint32_t x_packed, uint32_t h_packed);
+int32_t aux_accrd(uint32_t acc, uint32_t shamt);
+int16_t aux_accrd16(uint32_t acc, uint32_t shamt);
+void aux_accclr(uint32_t acc);
+void aux_accset(uint32_t acc, int32_t v);
+int16_t aux_bq_step(uint32_t sec, int16_t x);
+int16_t aux_bq_setc(uint32_t sec, uint32_t k, int16_t c);
+void aux_bq_set(uint32_t sec, int16_t b0, int16_t b1, int16_t b2, int16_t a1, int16_t a2);
+void aux_bq_clr(void);
+uint32_t aux_bfly_tw(uint32_t w_complex);
+uint32_t aux_bfly_twk(uint32_t k);
+uint32_t aux_bfly(uint32_t a, uint32_t b);
+uint32_t aux_bfly_scale(uint32_t a, uint32_t b);
+uint32_t aux_bfly_diff(void);
+int32_t aux_macc16(int32_t acc, uint32_t a, uint32_t b);
+int32_t aux_msubc16(int32_t acc, uint32_t a, uint32_t b);
+uint32_t aux_min16(uint32_t a, uint32_t b);
+uint32_t aux_max16(uint32_t a, uint32_t b);
+uint32_t aux_maxabs16(uint32_t a, uint32_t b);
+uint32_t aux_peakhold(uint32_t x);
+uint32_t aux_pk_cfg(uint32_t decay_shift);
+void aux_pk_clr(void);
+uint32_t aux_envf(uint32_t ch, uint32_t level);
+uint32_t aux_envf_abs(uint32_t ch, int16_t x);
+uint32_t aux_envf_sq(uint32_t ch, int16_t x);
+uint32_t aux_envf_cfg(uint32_t ch, uint32_t attack_shift, uint32_t release_shift);
+uint32_t aux_envf_set(uint32_t ch, uint32_t env);
+uint32_t aux_sincos(int16_t phase_q15);
+int16_t aux_atan2(uint32_t x_complex);
+uint32_t aux_cmag(uint32_t x_complex);
+int16_t aux_med3(int16_t x);
+int16_t aux_med5(int16_t x);
+void aux_med_clr(void);
+int16_t aux_lerp16(uint32_t ba, uint32_t frac_q15);
+uint32_t aux_lerp16x2(uint32_t a, uint32_t b, uint32_t frac_q15);
+uint32_t aux_arw(uint32_t k, uint32_t v);
+uint32_t aux_arr(uint32_t k);
+uint32_t aux_mac16a(uint32_t x, uint32_t k);
+int32_t aux_macc16a(int32_t acc, uint32_t x, uint32_t k);
+uint32_t aux_mulq15ra(uint32_t x, uint32_t k);
+uint32_t aux_conv4a(uint32_t x_packed, uint32_t k);
+int32_t aux_fir16_areg(const uint32_t *x);
+uint32_t aux_sat_status(void);
+uint32_t aux_sat_clear(uint32_t mask);
+uint32_t aux_lw_pi(const uint32_t **p);
+void aux_sw_pi(uint32_t **p, uint32_t v);
+int32_t aux_dot16(const uint32_t *x, const uint32_t *h, uint32_t pairs);
+int32_t aux_dot16_branch(const uint32_t *x, const uint32_t *h, uint32_t pairs);
+int32_t aux_dot16_pi(const uint32_t *x, const uint32_t *h, uint32_t pairs);
+
+/* SHIFTN rounding modes; AUX_SHN_NARROW in the aux_shiftn64() control
+ * word saturates to 16 bits instead of 32. */
+#define AUX_SHN_AWAY   0u  /* round half away from zero (plain SHIFTN) */
+#define AUX_SHN_TRUNC  1u  /* round towards minus infinity */
+#define AUX_SHN_EVEN   2u  /* round half to even */
+#define AUX_SHN_NARROW 0x100u
+
+/* Sticky saturation flags: bit n belongs to the op at funct7 0x20 + n. */
+#define AUX_SAT_ABS16   (1u << 0x02)
+#define AUX_SAT_CMAC    (1u << 0x06)
+#define AUX_SAT_CLIP16  (1u << 0x08)
+#define AUX_SAT_ACCRD   (1u << 0x0B)
+#define AUX_SAT_BIQUAD  (1u << 0x0D)
+#define AUX_SAT_LANE16  (1u << 0x0F)
+#define AUX_SAT_MULQ15  (1u << 0x10)
+#define AUX_SAT_MACC16  (1u << 0x14)
+#define AUX_SAT_MSUBC16 (1u << 0x15)
+#define AUX_SAT_MINMAX  (1u << 0x16)
+#define AUX_SAT_LERP16  (1u << 0x1A)
+#define AUX_SAT_AREG    (1u << 0x1B)
+#define AUX_SAT_ALL     0xFFFFFFFFu
+
+/* Instructions timed by aux_cycles8(); AUX_CPI_ADD is a plain `add`. */
+enum {
+    AUX_CPI_ADD,
+    AUX_CPI_MAC16,
+    AUX_CPI_ABS16,
+    AUX_CPI_CONV4,
+    AUX_CPI_CMAC,
+    AUX_CPI_SHIFTN,
+    AUX_CPI_ADD16S,
+    AUX_CPI_MIN16,
+    AUX_CPI_MULQ15,
+    AUX_CPI_COUNT
+};
+uint32_t aux_cycles8(uint32_t op);
 
 #endif
 
@@ -70,25 +70,36 @@ static int tag_eq(const char tag[4], char c0, char c1, char c2, char c3)
 
 /* --------------------------------------------------------------------
  * Core noise cleaning on 16-bit mono PCM using AUX opcodes.
- * - Uses all 10 AUX helpers from aux.h.
  * - Processes in-place: samples[] overwritten with cleaned output.
  * ------------------------------------------------------------------*/
 static void noise_clean_samples(int16_t *samples, uint32_t num_samples)
 {
     int32_t noise_energy_est = 0;
-    uint8_t env_hist[4] = {0, 0, 0, 0};
-    uint32_t env_idx = 0;
-    const uint32_t h_conv = 0x01010101u; /* 4-tap boxcar for CONV4/CONV8 */
+    const uint32_t h_conv = 0x01010101u; /* boxcar taps for CONV8 */
     const int16_t clip_limit = 30000;
 
     int16_t prev_x = 0;
     int16_t prev_diff = 0;
-    int16_t prev2_diff = 0;
-    int16_t lms_c0 = 0;
-    int16_t lms_c1 = 0;
+
+    /* 8-tap boxcar: h0..h3 come from rs2, h4..h7 from the CONV8 register. */
+    aux_conv8_seth(h_conv);
+    aux_conv8_clr();
+
+    /* Noise floor tracker on ENVF channel 0: 1/64 per sample both ways. */
+    aux_envf_cfg(0, 6u, 6u);
+    aux_envf_set(0, 0);
+
+    /* Declick window starts empty. */
+    aux_med_clr();
+
+    /* 2-tap LMS predictor: mu = 1/16 (Q15), update shift 15. */
+    aux_lms_cfg(0x0800, 15u, 2u);
+    aux_lms_clr();
 
     for (uint32_t i = 0; i < num_samples; i++) {
-        int16_t x = samples[i];
+        /* 0) Declick: 3-tap running median (MED3) removes single-sample
+         *    clicks and pops, at the cost of one sample of delay. */
+        int16_t x = aux_med3(samples[i]);
 
         /* 1) Soft-clip input to avoid overflow (CLIP16). */
         uint32_t x_pack = pack16(x, 0);
@@ -103,46 +114,25 @@ static void noise_clean_samples(int16_t *samples, uint32_t num_samples)
         uint32_t energy_u32 = aux_abs2(complex_pack); /* x^2 */
         int32_t energy = (int32_t)energy_u32;
 
-        /* 3) Slow noise floor estimate using SHIFTN for smoothing. */
-        int32_t diff_e = energy - noise_energy_est;
-        uint32_t diff_bits = (uint32_t)diff_e;
-        uint32_t delta_bits = aux_shiftn(diff_bits, 6u); /* divide by 64 with rounding */
-        int32_t delta_e = (int32_t)delta_bits;
-        noise_energy_est += delta_e;
-        if (noise_energy_est < 0)
-            noise_energy_est = 0;
-        if (noise_energy_est > (1 << 30))
-            noise_energy_est = (1 << 30);
-
-        /* 4) Short-term envelope via 4-sample boxcar (CONV4/CONV8). */
-        uint8_t env8 = (uint8_t)((abs_x >> 8) & 0xFF);
-        env_hist[env_idx] = env8;
-        env_idx = (env_idx + 1u) & 3u;
-
-        uint32_t env_packed =
-            (uint32_t)env_hist[0] |
-            ((uint32_t)env_hist[1] << 8) |
-            ((uint32_t)env_hist[2] << 16) |
-            ((uint32_t)env_hist[3] << 24);
+        /* 3) Slow noise floor estimate: est += round((energy - est) / 64)
+         *    in one ENVF step. It stays between 0 and the largest energy
+         *    seen (< 2^30), so no clamps are needed. */
+        noise_energy_est = (int32_t)aux_envf(0, energy_u32);
 
-        int32_t env4 = (int32_t)aux_conv4(env_packed, h_conv);
-        int32_t env8sum = (int32_t)aux_conv8(env_packed, h_conv);
-        int32_t env_sum = env4 + env8sum;
+        /* 4) Short-term envelope via 8-sample boxcar (CONV8 delay line). */
+        uint8_t env8 = (uint8_t)((abs_x >> 8) & 0xFF);
+        int32_t env_sum = (int32_t)aux_conv8_push(env8, h_conv);
 
         uint32_t env_sum_bits = (uint32_t)env_sum;
         uint32_t env_avg_bits = aux_shiftn(env_sum_bits, 3u); /* divide by 8 */
-        int32_t env_avg = (int32_t)env_avg_bits;
-        if (env_avg < 0)
-            env_avg = 0;
+        int32_t env_avg = (int16_t)(aux_max16(env_avg_bits, 0) & 0xFFFF); /* clamp at 0 */
 
         /* Early-out gate: treat very low-level regions as silence. */
         if (env_avg == 0) {
             samples[i] = 0;
             prev_x = x_clipped;
             prev_diff = 0;
-            prev2_diff = 0;
-            lms_c0 = 0;
-            lms_c1 = 0;
+            aux_lms_clr();
             continue;
         }
 
@@ -155,21 +145,12 @@ static void noise_clean_samples(int16_t *samples, uint32_t num_samples)
         uint32_t sum_u = aux_msub16(hp_x_pack, hp_h_pack);
         int32_t sum_dc = (int32_t)sum_u;
 
-        /* 7) Two-tap predictor on recent high-pass output (LMSSTEP). */
-        uint32_t lms_x_pack = pack16(prev_diff, prev2_diff);
-        uint32_t lms_h_pack = pack16(lms_c0, lms_c1);
-        int32_t pred = (int32_t)aux_lmsstep(lms_x_pack, lms_h_pack);
-        int32_t err = hp_out - pred;
-
-        /* LMS coefficient update: very small step using SHIFTN. */
-        int32_t grad = err * (int32_t)prev_diff;
-        uint32_t grad_bits = (uint32_t)grad;
-        uint32_t grad_scaled_bits = aux_shiftn(grad_bits, 12u);
-        int16_t delta_c = (int16_t)grad_scaled_bits;
-        lms_c0 = (int16_t)(lms_c0 + delta_c);
-        lms_c1 = lms_c0;
-
-        prev2_diff = prev_diff;
+        /* 7) Two-tap predictor on recent high-pass output (LMSSTEP).
+         *    Prediction and coefficient update both run in hardware;
+         *    the unit keeps the x history, rd = {err, pred}. As with the
+         *    old software predictor, pred and err only drive the
+         *    coefficient update; the output path below is unchanged. */
+        (void)aux_lmsstep(prev_diff, (int16_t)hp_out);
         prev_diff = (int16_t)hp_out;
 
         /* 8) Mix high-passed signal and DC estimate with CMAC. */
@@ -198,25 +179,19 @@ static void noise_clean_samples(int16_t *samples, uint32_t num_samples)
             gain_q15 = 0x7FFFu;      /* near unity */
         }
 
-        /* Mild dynamic compression from short-term envelope. */
-        if (env_avg > 200 && gain_q15 > 0x6000u)
-            gain_q15 = 0x6000u;
+        /* Mild dynamic compression from short-term envelope: cap the gain
+         * at 0x6000 while env_avg > 200 (MIN16, no branch). */
+        uint32_t gain_cap = 0x7FFFu - ((0u - (uint32_t)(env_avg > 200)) & 0x1FFFu);
+        gain_q15 = aux_min16(gain_q15, gain_cap) & 0xFFFFu;
 
-        /* 10) Apply gain using MAC16 + SHIFTN, then final CLIP16. */
+        /* 10) Apply gain with one rounded, saturating Q15 multiply (MULQ15R).
+         *     Not bit-exact with the old MAC16/SHIFTN/CLIP16 chain: negative
+         *     halves round up, and -32768 is no longer clipped to -32767. */
         if (gain_q15 == 0) {
             samples[i] = 0;
         } else {
-            uint32_t scale_x_pack = pack16(mixed, 0);
-            uint32_t scale_h_pack = pack16((int16_t)gain_q15, 0);
-            int32_t scaled32 = (int32_t)aux_mac16(scale_x_pack, scale_h_pack);
-            uint32_t scaled_bits = aux_shiftn((uint32_t)scaled32, 15u);
-            int16_t y = (int16_t)scaled_bits;
-
-            uint32_t y_pack = pack16(y, 0);
-            uint32_t y_clip_pack = aux_clip16(y_pack, 32767);
-            int16_t y_clip = (int16_t)(y_clip_pack & 0xFFFF);
-
-            samples[i] = y_clip;
+            uint32_t y_pack = aux_mulq15r(pack16(mixed, 0), gain_q15);
+            samples[i] = (int16_t)(y_pack & 0xFFFF);
         }
 
         prev_x = x_clipped;
@@ -244,6 +219,97 @@ static void noise_clean_wav_inplace(WavHeader *hdr, int16_t *samples)
     noise_clean_samples(samples, num_samples);
 }
 
+/* --------------------------------------------------------------------
+ * Hardware loop benchmark: the same MAC16 dot product with and without
+ * LP.SETUP, and with LW.PI post-increment loads, timed with rdcycle.
+ * ------------------------------------------------------------------*/
+#define DOT16_PAIRS 32u
+
+static inline uint32_t rdcycle(void)
+{
+    uint32_t c;
+    __asm__ volatile ("rdcycle %0" : "=r"(c));
+    return c;
+}
+
+static void bench_hwloop(void)
+{
+    static uint32_t x[DOT16_PAIRS], h[DOT16_PAIRS];
+    for (uint32_t k = 0; k < DOT16_PAIRS; k++) {
+        x[k] = pack16((int16_t)(k * 301 - 4000), (int16_t)(2500 - k * 97));
+        h[k] = pack16((int16_t)(k * 13 + 7), (int16_t)(50 - k * 3));
+    }
+
+    uint32_t t0 = rdcycle();
+    int32_t ref = aux_dot16_branch(x, h, DOT16_PAIRS);
+    uint32_t t1 = rdcycle();
+    int32_t res = aux_dot16(x, h, DOT16_PAIRS);
+    uint32_t t2 = rdcycle();
+    int32_t res_pi = aux_dot16_pi(x, h, DOT16_PAIRS);
+    uint32_t t3 = rdcycle();
+
+    puts("dot16 branch loop cycles: ");
+    print_uint(t1 - t0);
+    nl();
+    puts("dot16 hw loop cycles: ");
+    print_uint(t2 - t1);
+    nl();
+    puts("dot16 hw loop + post-inc cycles: ");
+    print_uint(t3 - t2);
+    nl();
+    if (res != ref)
+        puts("dot16 hw loop MISMATCH\n");
+    if (res_pi != ref)
+        puts("dot16 post-inc MISMATCH\n");
+}
+
+/* --------------------------------------------------------------------
+ * 16-tap FIR with the taps in the audio register file, against the same
+ * sum with the taps loaded from memory.
+ * ------------------------------------------------------------------*/
+static void bench_areg_fir(void)
+{
+    static uint32_t x[8], h[8];
+    for (uint32_t k = 0; k < 8; k++) {
+        x[k] = pack16((int16_t)(k * 1201 - 5000), (int16_t)(3000 - k * 411));
+        h[k] = pack16((int16_t)(k * 500 + 100), (int16_t)(900 - k * 170));
+        aux_arw(k, h[k]);
+    }
+
+    uint32_t t0 = rdcycle();
+    int32_t ref = aux_dot16_branch(x, h, 8);
+    uint32_t t1 = rdcycle();
+    int32_t res = aux_fir16_areg(x);
+    uint32_t t2 = rdcycle();
+
+    puts("fir16 taps from memory cycles: ");
+    print_uint(t1 - t0);
+    nl();
+    puts("fir16 taps in aregs cycles: ");
+    print_uint(t2 - t1);
+    nl();
+    if (res != ref)
+        puts("fir16 areg MISMATCH\n");
+}
+
+/* --------------------------------------------------------------------
+ * Cycles for eight back-to-back instances of each op (rdcycle pair
+ * included), next to a plain add for reference.
+ * ------------------------------------------------------------------*/
+static void bench_aux_cpi(void)
+{
+    static const char *const names[AUX_CPI_COUNT] = {
+        "add", "mac16", "abs16", "conv4", "cmac", "shiftn", "add16s", "min16", "mulq15"
+    };
+    for (uint32_t op = 0; op < AUX_CPI_COUNT; op++) {
+        puts("cycles x8 ");
+        puts(names[op]);
+        puts(": ");
+        print_uint(aux_cycles8(op));
+        nl();
+    }
+}
+
 /* --------------------------------------------------------------------
  * main: build a tiny test WAV, clean it using the AUX opcodes,
  *       and print a small summary over UART.
@@ -254,7 +320,10 @@ int main(void)
 
     puts("Audio AUX noise-clean demo\n");
 
+    /* Saturation is checked once for the whole buffer, not per sample. */
+    aux_sat_clear(AUX_SAT_ALL);
     noise_clean_wav_inplace(&wav_buffer.hdr, wav_buffer.samples);
+    uint32_t sat = aux_sat_status();
 
     WavHeader *hdr = &wav_buffer.hdr;
     uint32_t num_samples = hdr->data_size / 2u;
@@ -271,12 +340,22 @@ int main(void)
     print_uint(num_samples);
     nl();
 
+    puts("Saturation flags (hex): ");
+    print_hex32(sat);
+    if (sat & AUX_SAT_CLIP16)
+        puts(" input clipped");
+    nl();
+
     if (num_samples > 0) {
         puts("First sample raw16: ");
         print_raw16((uint32_t)(uint16_t)samples[0]);
         nl();
     }
 
+    bench_hwloop();
+    bench_areg_fir();
+    bench_aux_cpi();
+
     *PASS = 123456789;
     __asm__ volatile("ebreak");
 
@@ -77,6 +77,15 @@ module picorv32 #(
 	parameter [ 0:0] ENABLE_FAST_MUL = 0,
 	parameter [ 0:0] ENABLE_DIV = 0,
 	parameter [ 0:0] ENABLE_AUDIO = 0,
+	parameter [ 1:0] AUDIO_PIPELINE_STAGES = 0,
+	parameter [ 6:0] AUDIO_LMS_TAPS = 16,
+	parameter [ 4:0] AUDIO_CORDIC_ITERS = 16,
+	parameter [ 4:0] AUDIO_AREGS = 16,
+	parameter [31:0] AUDIO_OPS = 32'hffff_ffff,
+	parameter [ 0:0] AUDIO_SHARED_MUL = 0,
+	parameter [ 0:0] AUDIO_FAST_DECODE = 0,
+	parameter [ 0:0] ENABLE_HWLOOP = 0,
+	parameter [ 0:0] ENABLE_POSTINC = 0,
 	parameter [ 0:0] ENABLE_IRQ = 0,
 	parameter [ 0:0] ENABLE_IRQ_QREGS = 1,
 	parameter [ 0:0] ENABLE_IRQ_TIMER = 1,
@@ -169,12 +178,24 @@ module picorv32 #(
 
 	localparam WITH_PCPI = ENABLE_PCPI || ENABLE_MUL || ENABLE_FAST_MUL || ENABLE_DIV || ENABLE_AUDIO;
 
+	// MACC16/MSUBC16, SHIFTN's 64-bit form, LERP16.X2 and AREG MACC16.A
+	// read rd as a third source. The internal register file gets a third
+	// read port only if AUDIO_OPS keeps one of them (bits 9, 20, 21, 26,
+	// 27); an external PICORV32_REGS file has only two, so these ops trap
+	// there.
+`ifndef PICORV32_REGS
+	localparam WITH_AUX_RS3 = ENABLE_AUDIO && |{AUDIO_OPS[9], AUDIO_OPS[20], AUDIO_OPS[21], AUDIO_OPS[26], AUDIO_OPS[27]};
+`else
+	localparam WITH_AUX_RS3 = 0;
+`endif
+
 	localparam [35:0] TRACE_BRANCH = {4'b 0001, 32'b 0};
 	localparam [35:0] TRACE_ADDR   = {4'b 0010, 32'b 0};
 	localparam [35:0] TRACE_IRQ    = {4'b 1000, 32'b 0};
 
 	reg [63:0] count_cycle, count_instr;
 	reg [31:0] reg_pc, reg_next_pc, reg_op1, reg_op2, reg_out;
+	reg [31:0] reg_op3;
 	reg [4:0] reg_sh;
 
 	reg [31:0] next_insn_opcode;
@@ -200,6 +221,10 @@ module picorv32 #(
 	reg [31:0] irq_pending;
 	reg [31:0] timer;
 
+	// Hardware loop: when an instruction at hwloop_end is issued and
+	// hwloop_count is non-zero, the next PC is hwloop_start instead.
+	reg [31:0] hwloop_start, hwloop_end, hwloop_count;
+
 `ifndef PICORV32_REGS
 	reg [31:0] cpuregs [0:regfile_size-1];
 
@@ -269,6 +294,18 @@ module picorv32 #(
 	wire [31:0] pcpi_audio_rd;
 	wire        pcpi_audio_wait;
 	wire        pcpi_audio_ready;
+	wire        pcpi_audio_fast;
+	wire [31:0] pcpi_audio_fast_rs1;
+	wire [31:0] pcpi_audio_fast_rs2;
+	wire [31:0] pcpi_audio_fast_rs3;
+	wire        pcpi_audio_fast_ready;
+
+	// Multiplier of picorv32_pcpi_fast_mul lent to the audio unit
+	// (AUDIO_SHARED_MUL).
+	wire        audio_mul_req;
+	wire [32:0] audio_mul_a;
+	wire [32:0] audio_mul_b;
+	wire [63:0] audio_mul_y;
 
 	reg        pcpi_int_wr;
 	reg [31:0] pcpi_int_rd;
@@ -276,7 +313,9 @@ module picorv32 #(
 	reg        pcpi_int_ready;
 
 	generate if (ENABLE_FAST_MUL) begin
-		picorv32_pcpi_fast_mul pcpi_mul (
+		picorv32_pcpi_fast_mul #(
+			.SHARED_MUL(ENABLE_AUDIO && AUDIO_SHARED_MUL)
+		) pcpi_mul (
 			.clk       (clk            ),
 			.resetn    (resetn         ),
 			.pcpi_valid(pcpi_valid     ),
@@ -286,7 +325,11 @@ module picorv32 #(
 			.pcpi_wr   (pcpi_mul_wr    ),
 			.pcpi_rd   (pcpi_mul_rd    ),
 			.pcpi_wait (pcpi_mul_wait  ),
-			.pcpi_ready(pcpi_mul_ready )
+			.pcpi_ready(pcpi_mul_ready ),
+			.mul_req   (audio_mul_req  ),
+			.mul_a     (audio_mul_a    ),
+			.mul_b     (audio_mul_b    ),
+			.mul_y     (audio_mul_y    )
 		);
 	end else if (ENABLE_MUL) begin
 		picorv32_pcpi_mul pcpi_mul (
@@ -308,6 +351,10 @@ module picorv32 #(
 		assign pcpi_mul_ready = 0;
 	end endgenerate
 
+	generate if (!ENABLE_FAST_MUL) begin
+		assign audio_mul_y = 64'bx;
+	end endgenerate
+
 	generate if (ENABLE_DIV) begin
 		picorv32_pcpi_div pcpi_div (
 			.clk       (clk            ),
@@ -329,23 +376,45 @@ module picorv32 #(
 	end endgenerate
 
 	generate if (ENABLE_AUDIO) begin
-		picorv32_pcpi_audio pcpi_audio (
+		picorv32_pcpi_audio #(
+			.PIPELINE_STAGES(AUDIO_PIPELINE_STAGES),
+			.LMS_TAPS       (AUDIO_LMS_TAPS       ),
+			.CORDIC_ITERS   (AUDIO_CORDIC_ITERS   ),
+			.AREGS          (AUDIO_AREGS          ),
+			.OPS            (AUDIO_OPS            ),
+			.WITH_RS3       (WITH_AUX_RS3         ),
+			.SHARED_MUL     (AUDIO_SHARED_MUL && ENABLE_FAST_MUL)
+		) pcpi_audio (
 			.clk       (clk            ),
 			.resetn    (resetn         ),
 			.pcpi_valid(pcpi_valid     ),
 			.pcpi_insn (pcpi_insn      ),
 			.pcpi_rs1  (pcpi_rs1       ),
 			.pcpi_rs2  (pcpi_rs2       ),
+			.pcpi_rs3  (reg_op3        ),
 			.pcpi_wr   (pcpi_audio_wr  ),
 			.pcpi_rd   (pcpi_audio_rd  ),
 			.pcpi_wait (pcpi_audio_wait),
-			.pcpi_ready(pcpi_audio_ready)
+			.pcpi_ready(pcpi_audio_ready),
+			.fast_valid(pcpi_audio_fast),
+			.fast_rs1  (pcpi_audio_fast_rs1),
+			.fast_rs2  (pcpi_audio_fast_rs2),
+			.fast_rs3  (pcpi_audio_fast_rs3),
+			.fast_ready(pcpi_audio_fast_ready),
+			.mul_req   (audio_mul_req  ),
+			.mul_a     (audio_mul_a    ),
+			.mul_b     (audio_mul_b    ),
+			.mul_y     (audio_mul_y    )
 		);
 	end else begin
 		assign pcpi_audio_wr = 0;
 		assign pcpi_audio_rd = 32'bx;
 		assign pcpi_audio_wait = 0;
 		assign pcpi_audio_ready = 0;
+		assign pcpi_audio_fast_ready = 0;
+		assign audio_mul_req = 0;
+		assign audio_mul_a = 33'bx;
+		assign audio_mul_b = 33'bx;
 	end endgenerate
 
 	always @* begin
@@ -680,10 +749,14 @@ module picorv32 #(
 	reg instr_add, instr_sub, instr_sll, instr_slt, instr_sltu, instr_xor, instr_srl, instr_sra, instr_or, instr_and;
 	reg instr_rdcycle, instr_rdcycleh, instr_rdinstr, instr_rdinstrh, instr_ecall_ebreak, instr_fence;
 	reg instr_getq, instr_setq, instr_retirq, instr_maskirq, instr_waitirq, instr_timer;
+	reg instr_lpsetup;
+	reg instr_lwpi, instr_swpi;
+	reg instr_aux_fast;
 	wire instr_trap;
 
 	reg [regindex_bits-1:0] decoded_rd, decoded_rs1;
 	reg [4:0] decoded_rs2;
+	reg [4:0] decoded_swpi_step;  // raw rd field, decoded_rd may be 4 bits
 	reg [31:0] decoded_imm, decoded_imm_j;
 	reg decoder_trigger;
 	reg decoder_trigger_q;
@@ -712,7 +785,8 @@ module picorv32 #(
 			instr_addi, instr_slti, instr_sltiu, instr_xori, instr_ori, instr_andi, instr_slli, instr_srli, instr_srai,
 			instr_add, instr_sub, instr_sll, instr_slt, instr_sltu, instr_xor, instr_srl, instr_sra, instr_or, instr_and,
 			instr_rdcycle, instr_rdcycleh, instr_rdinstr, instr_rdinstrh, instr_fence,
-			instr_getq, instr_setq, instr_retirq, instr_maskirq, instr_waitirq, instr_timer};
+			instr_getq, instr_setq, instr_retirq, instr_maskirq, instr_waitirq, instr_timer, instr_lpsetup,
+			instr_lwpi, instr_swpi};
 
 	wire is_rdcycle_rdcycleh_rdinstr_rdinstrh;
 	assign is_rdcycle_rdcycleh_rdinstr_rdinstrh = |{instr_rdcycle, instr_rdcycleh, instr_rdinstr, instr_rdinstrh};
@@ -785,6 +859,9 @@ module picorv32 #(
 		if (instr_maskirq)  new_ascii_instr = "maskirq";
 		if (instr_waitirq)  new_ascii_instr = "waitirq";
 		if (instr_timer)    new_ascii_instr = "timer";
+		if (instr_lpsetup)  new_ascii_instr = "lp.setup";
+		if (instr_lwpi)     new_ascii_instr = "lw.pi";
+		if (instr_swpi)     new_ascii_instr = "sw.pi";
 	end
 
 	reg [63:0] q_ascii_instr;
@@ -890,7 +967,7 @@ module picorv32 #(
 		is_lui_auipc_jal_jalr_addi_add_sub <= |{instr_lui, instr_auipc, instr_jal, instr_jalr, instr_addi, instr_add, instr_sub};
 		is_slti_blt_slt <= |{instr_slti, instr_blt, instr_slt};
 		is_sltiu_bltu_sltu <= |{instr_sltiu, instr_bltu, instr_sltu};
-		is_lbu_lhu_lw <= |{instr_lbu, instr_lhu, instr_lw};
+		is_lbu_lhu_lw <= |{instr_lbu, instr_lhu, instr_lw, instr_lwpi};
 		is_compare <= |{is_beq_bne_blt_bge_bltu_bgeu, instr_slti, instr_slt, instr_sltiu, instr_sltu};
 
 		if (mem_do_rinst && mem_done) begin
@@ -900,6 +977,9 @@ module picorv32 #(
 			instr_jalr    <= mem_rdata_latched[6:0] == 7'b1100111 && mem_rdata_latched[14:12] == 3'b000;
 			instr_retirq  <= mem_rdata_latched[6:0] == 7'b0001011 && mem_rdata_latched[31:25] == 7'b0000010 && ENABLE_IRQ;
 			instr_waitirq <= mem_rdata_latched[6:0] == 7'b0001011 && mem_rdata_latched[31:25] == 7'b0000100 && ENABLE_IRQ;
+			instr_lpsetup <= mem_rdata_latched[6:0] == 7'b0001011 && mem_rdata_latched[31:25] == 7'b0000110 && ENABLE_HWLOOP;
+			instr_lwpi    <= mem_rdata_latched[6:0] == 7'b0001011 && mem_rdata_latched[31:25] == 7'b0000111 && mem_rdata_latched[14:12] == 3'b010 && ENABLE_POSTINC;
+			instr_swpi    <= mem_rdata_latched[6:0] == 7'b0001011 && mem_rdata_latched[31:25] == 7'b0001000 && mem_rdata_latched[14:12] == 3'b010 && ENABLE_POSTINC;
 
 			is_beq_bne_blt_bge_bltu_bgeu <= mem_rdata_latched[6:0] == 7'b1100011;
 			is_lb_lh_lw_lbu_lhu          <= mem_rdata_latched[6:0] == 7'b0000011;
@@ -912,6 +992,7 @@ module picorv32 #(
 			decoded_rd <= mem_rdata_latched[11:7];
 			decoded_rs1 <= mem_rdata_latched[19:15];
 			decoded_rs2 <= mem_rdata_latched[24:20];
+			decoded_swpi_step <= mem_rdata_latched[11:7];
 
 			if (mem_rdata_latched[6:0] == 7'b0001011 && mem_rdata_latched[31:25] == 7'b0000000 && ENABLE_IRQ && ENABLE_IRQ_QREGS)
 				decoded_rs1[regindex_bits-1] <= 1; // instr_getq
@@ -1122,6 +1203,17 @@ module picorv32 #(
 			instr_maskirq <= mem_rdata_q[6:0] == 7'b0001011 && mem_rdata_q[31:25] == 7'b0000011 && ENABLE_IRQ;
 			instr_timer   <= mem_rdata_q[6:0] == 7'b0001011 && mem_rdata_q[31:25] == 7'b0000101 && ENABLE_IRQ && ENABLE_IRQ_TIMER;
 
+			// AUX funct7 0x20..0x2F, 0x34..0x37 and 0x39..0x3F (all but the
+			// iterative CORDIC at 0x38): offered to the audio unit straight
+			// from the register file in ld_rs1 (see pcpi_audio_fast).
+			// Requires both read ports and the combinational audio datapath,
+			// which this puts on the core's critical path, so it is opt-in
+			// (AUDIO_FAST_DECODE = 1).
+			instr_aux_fast <= mem_rdata_q[6:0] == 7'b0001011 &&
+					(mem_rdata_q[31:28] == 4'b0010 || mem_rdata_q[31:27] == 5'b01101 ||
+					 mem_rdata_q[31:28] == 4'b0111 && mem_rdata_q[31:25] != 7'b0111000) &&
+					ENABLE_AUDIO && AUDIO_FAST_DECODE && AUDIO_PIPELINE_STAGES == 0 && ENABLE_REGS_DUALPORT;
+
 			is_slli_srli_srai <= is_alu_reg_imm && |{
 				mem_rdata_q[14:12] == 3'b001 && mem_rdata_q[31:25] == 7'b0000000,
 				mem_rdata_q[14:12] == 3'b101 && mem_rdata_q[31:25] == 7'b0000000,
@@ -1158,6 +1250,10 @@ module picorv32 #(
 					decoded_imm <= $signed({mem_rdata_q[31], mem_rdata_q[7], mem_rdata_q[30:25], mem_rdata_q[11:8], 1'b0});
 				is_sb_sh_sw:
 					decoded_imm <= $signed({mem_rdata_q[31:25], mem_rdata_q[11:7]});
+				instr_lpsetup:
+					decoded_imm <= {mem_rdata_q[24:20], mem_rdata_q[11:7], 1'b0};
+				|{instr_lwpi, instr_swpi}:
+					decoded_imm <= 0;
 				default:
 					decoded_imm <= 1'bx;
 			endcase
@@ -1232,6 +1328,7 @@ module picorv32 #(
 	reg latched_store;
 	reg latched_stalu;
 	reg latched_branch;
+	reg latched_hwloop;
 	reg latched_compr;
 	reg latched_trace;
 	reg latched_is_lu;
@@ -1239,6 +1336,12 @@ module picorv32 #(
 	reg latched_is_lb;
 	reg [regindex_bits-1:0] latched_rd;
 
+	// LW.PI/SW.PI: the pointer update is written back in the first
+	// ldmem/stmem cycle (the register file write port is idle there),
+	// then latched_rd switches to the load destination.
+	reg latched_postinc;
+	reg [regindex_bits-1:0] postinc_rd;
+
 	reg [31:0] current_pc;
 	assign next_pc = latched_store && latched_branch ? reg_out & ~1 : reg_next_pc;
 
@@ -1326,7 +1429,7 @@ module picorv32 #(
 		clear_prefetched_high_word = clear_prefetched_high_word_q;
 		if (!prefetched_high_word)
 			clear_prefetched_high_word = 0;
-		if (latched_branch || irq_state || !resetn)
+		if (latched_branch || latched_hwloop || irq_state || !resetn)
 			clear_prefetched_high_word = COMPRESSED_ISA;
 	end
 
@@ -1334,6 +1437,12 @@ module picorv32 #(
 	reg [31:0] cpuregs_wrdata;
 	reg [31:0] cpuregs_rs1;
 	reg [31:0] cpuregs_rs2;
+	reg [31:0] cpuregs_rs3;
+
+	assign pcpi_audio_fast = instr_aux_fast && cpu_state == cpu_state_ld_rs1;
+	assign pcpi_audio_fast_rs1 = cpuregs_rs1;
+	assign pcpi_audio_fast_rs2 = cpuregs_rs2;
+	assign pcpi_audio_fast_rs3 = cpuregs_rs3;
 	reg [regindex_bits-1:0] decoded_rs;
 
 	always @* begin
@@ -1361,6 +1470,11 @@ module picorv32 #(
 				end
 			endcase
 		end
+
+		if (ENABLE_POSTINC && latched_postinc && (cpu_state == cpu_state_ldmem || cpu_state == cpu_state_stmem)) begin
+			cpuregs_wrdata = reg_out;
+			cpuregs_write = 1;
+		end
 	end
 
 `ifndef PICORV32_REGS
@@ -1377,6 +1491,11 @@ module picorv32 #(
 
 	always @* begin
 		decoded_rs = 'bx;
+`ifndef RISCV_FORMAL_BLACKBOX_REGS
+		cpuregs_rs3 = WITH_AUX_RS3 && decoded_rd ? cpuregs[decoded_rd] : 0;
+`else
+		cpuregs_rs3 = WITH_AUX_RS3 && decoded_rd ? $anyseq : 0;
+`endif
 		if (ENABLE_REGS_DUALPORT) begin
 `ifndef RISCV_FORMAL_BLACKBOX_REGS
 			cpuregs_rs1 = decoded_rs1 ? cpuregs[decoded_rs1] : 0;
@@ -1416,6 +1535,7 @@ module picorv32 #(
 
 	always @* begin
 		decoded_rs = 'bx;
+		cpuregs_rs3 = 'bx;
 		if (ENABLE_REGS_DUALPORT) begin
 			cpuregs_rs1 = decoded_rs1 ? cpuregs_rdata1 : 0;
 			cpuregs_rs2 = decoded_rs2 ? cpuregs_rdata2 : 0;
@@ -1492,6 +1612,8 @@ module picorv32 #(
 			latched_store <= 0;
 			latched_stalu <= 0;
 			latched_branch <= 0;
+			latched_hwloop <= 0;
+			latched_postinc <= 0;
 			latched_trace <= 0;
 			latched_is_lu <= 0;
 			latched_is_lh <= 0;
@@ -1505,6 +1627,7 @@ module picorv32 #(
 			irq_state <= 0;
 			eoi <= 0;
 			timer <= 0;
+			hwloop_count <= 0;
 			if (~STACKADDR) begin
 				latched_store <= 1;
 				latched_rd <= 2;
@@ -1544,6 +1667,17 @@ module picorv32 #(
 					end
 				endcase
 
+				// A taken branch or non-linking jump from inside the loop body
+				// to outside it ends the hardware loop, so a later pass over
+				// hwloop_end does not jump back. Calls (jal/jalr with rd != x0,
+				// which write the return address here) leave it armed, and so
+				// do branches inside the callee or an interrupt handler, whose
+				// reg_pc is outside the body.
+				if (ENABLE_HWLOOP && latched_branch && !latched_rd &&
+						reg_pc >= hwloop_start && reg_pc <= hwloop_end &&
+						(current_pc < hwloop_start || current_pc > hwloop_end))
+					hwloop_count <= 0;
+
 				if (ENABLE_TRACE && latched_trace) begin
 					latched_trace <= 0;
 					trace_valid <= 1;
@@ -1559,6 +1693,7 @@ module picorv32 #(
 				latched_store <= 0;
 				latched_stalu <= 0;
 				latched_branch <= 0;
+				latched_hwloop <= 0;
 				latched_is_lu <= 0;
 				latched_is_lh <= 0;
 				latched_is_lb <= 0;
@@ -1588,6 +1723,11 @@ module picorv32 #(
 					`debug($display("-- %-0t", $time);)
 					irq_delay <= irq_active;
 					reg_next_pc <= current_pc + (compressed_instr ? 2 : 4);
+					if (ENABLE_HWLOOP && hwloop_count && current_pc == hwloop_end) begin
+						reg_next_pc <= hwloop_start;
+						hwloop_count <= hwloop_count - 1;
+						latched_hwloop <= 1;
+					end
 					if (ENABLE_TRACE)
 						latched_trace <= 1;
 					if (ENABLE_COUNTERS) begin
@@ -1612,10 +1752,30 @@ module picorv32 #(
 
 				(* parallel_case *)
 				case (1'b1)
-					(CATCH_ILLINSN || WITH_PCPI) && instr_trap: begin
+					ENABLE_AUDIO && instr_aux_fast && pcpi_audio_fast_ready: begin
+						// Single-cycle AUX op: write back like an ALU op and
+						// overlap the next fetch, no PCPI handshake.
+						`debug($display("LD_RS1: %2d 0x%08x", decoded_rs1, cpuregs_rs1);)
+						`debug($display("LD_RS2: %2d 0x%08x", decoded_rs2, cpuregs_rs2);)
+						dbg_rs1val <= cpuregs_rs1;
+						dbg_rs1val_valid <= 1;
+						dbg_rs2val <= cpuregs_rs2;
+						dbg_rs2val_valid <= 1;
+						reg_out <= pcpi_audio_rd;
+						latched_store <= pcpi_audio_wr;
+						mem_do_rinst <= mem_do_prefetch;
+						cpu_state <= cpu_state_fetch;
+					end
+					// instr_trap also covers fast AUX ops: exclude the ones
+					// completed above so the items stay mutually exclusive
+					// under parallel_case. An AUX op the unit declines
+					// (fast_ready = 0 for the whole ld_rs1 state) takes
+					// only this item and goes through the PCPI handshake.
+					(CATCH_ILLINSN || WITH_PCPI) && instr_trap && !(ENABLE_AUDIO && instr_aux_fast && pcpi_audio_fast_ready): begin
 						if (WITH_PCPI) begin
 							`debug($display("LD_RS1: %2d 0x%08x", decoded_rs1, cpuregs_rs1);)
 							reg_op1 <= cpuregs_rs1;
+							reg_op3 <= cpuregs_rs3;
 							dbg_rs1val <= cpuregs_rs1;
 							dbg_rs1val_valid <= 1;
 							if (ENABLE_REGS_DUALPORT) begin
@@ -1723,6 +1883,46 @@ module picorv32 #(
 						dbg_rs1val_valid <= 1;
 						cpu_state <= cpu_state_fetch;
 					end
+					ENABLE_HWLOOP && instr_lpsetup: begin
+						`debug($display("LD_RS1: %2d 0x%08x", decoded_rs1, cpuregs_rs1);)
+						hwloop_start <= reg_pc + 4;
+						hwloop_end <= reg_pc + decoded_imm;
+						hwloop_count <= cpuregs_rs1 ? cpuregs_rs1 - 1 : 0;
+						dbg_rs1val <= cpuregs_rs1;
+						dbg_rs1val_valid <= 1;
+						cpu_state <= cpu_state_fetch;
+					end
+					ENABLE_POSTINC && instr_lwpi: begin
+						`debug($display("LD_RS1: %2d 0x%08x", decoded_rs1, cpuregs_rs1);)
+						reg_op1 <= cpuregs_rs1;
+						reg_out <= cpuregs_rs1 + {{25{decoded_rs2[4]}}, decoded_rs2[4:0], 2'b00};
+						dbg_rs1val <= cpuregs_rs1;
+						dbg_rs1val_valid <= 1;
+						latched_rd <= decoded_rs1;
+						latched_postinc <= 1;
+						postinc_rd <= decoded_rd;
+						cpu_state <= cpu_state_ldmem;
+						mem_do_rinst <= 1;
+					end
+					ENABLE_POSTINC && instr_swpi: begin
+						`debug($display("LD_RS1: %2d 0x%08x", decoded_rs1, cpuregs_rs1);)
+						reg_op1 <= cpuregs_rs1;
+						reg_out <= cpuregs_rs1 + {{25{decoded_swpi_step[4]}}, decoded_swpi_step, 2'b00};
+						dbg_rs1val <= cpuregs_rs1;
+						dbg_rs1val_valid <= 1;
+						latched_rd <= decoded_rs1;
+						latched_postinc <= 1;
+						if (ENABLE_REGS_DUALPORT) begin
+							`debug($display("LD_RS2: %2d 0x%08x", decoded_rs2, cpuregs_rs2);)
+							reg_sh <= cpuregs_rs2;
+							reg_op2 <= cpuregs_rs2;
+							dbg_rs2val <= cpuregs_rs2;
+							dbg_rs2val_valid <= 1;
+							cpu_state <= cpu_state_stmem;
+							mem_do_rinst <= 1;
+						end else
+							cpu_state <= cpu_state_ld_rs2;
+					end
 					is_lb_lh_lw_lbu_lhu && !instr_trap: begin
 						`debug($display("LD_RS1: %2d 0x%08x", decoded_rs1, cpuregs_rs1);)
 						reg_op1 <= cpuregs_rs1;
@@ -1814,7 +2014,7 @@ module picorv32 #(
 								cpu_state <= cpu_state_trap;
 						end
 					end
-					is_sb_sh_sw: begin
+					is_sb_sh_sw || ENABLE_POSTINC && instr_swpi: begin
 						cpu_state <= cpu_state_stmem;
 						mem_do_rinst <= 1;
 					end
@@ -1884,13 +2084,14 @@ module picorv32 #(
 			cpu_state_stmem: begin
 				if (ENABLE_TRACE)
 					reg_out <= reg_op2;
+				latched_postinc <= 0;
 				if (!mem_do_prefetch || mem_done) begin
 					if (!mem_do_wdata) begin
 						(* parallel_case, full_case *)
 						case (1'b1)
 							instr_sb: mem_wordsize <= 2;
 							instr_sh: mem_wordsize <= 1;
-							instr_sw: mem_wordsize <= 0;
+							instr_sw || instr_swpi: mem_wordsize <= 0;
 						endcase
 						if (ENABLE_TRACE) begin
 							trace_valid <= 1;
@@ -1909,13 +2110,17 @@ module picorv32 #(
 
 			cpu_state_ldmem: begin
 				latched_store <= 1;
+				if (ENABLE_POSTINC && latched_postinc) begin
+					latched_postinc <= 0;
+					latched_rd <= postinc_rd;
+				end
 				if (!mem_do_prefetch || mem_done) begin
 					if (!mem_do_rdata) begin
 						(* parallel_case, full_case *)
 						case (1'b1)
 							instr_lb || instr_lbu: mem_wordsize <= 2;
 							instr_lh || instr_lhu: mem_wordsize <= 1;
-							instr_lw: mem_wordsize <= 0;
+							instr_lw || instr_lwpi: mem_wordsize <= 0;
 						endcase
 						latched_is_lu <= is_lbu_lhu_lw;
 						latched_is_lh <= instr_lh;
@@ -2348,7 +2553,8 @@ endmodule
 module picorv32_pcpi_fast_mul #(
 	parameter EXTRA_MUL_FFS = 0,
 	parameter EXTRA_INSN_FFS = 0,
-	parameter MUL_CLKGATE = 0
+	parameter MUL_CLKGATE = 0,
+	parameter SHARED_MUL = 0
 ) (
 	input clk, resetn,
 
@@ -2359,7 +2565,17 @@ module picorv32_pcpi_fast_mul #(
 	output            pcpi_wr,
 	output     [31:0] pcpi_rd,
 	output            pcpi_wait,
-	output            pcpi_ready
+	output            pcpi_ready,
+
+	// Shared use by picorv32_pcpi_audio (SHARED_MUL): while mul_req is set
+	// the multiplier computes mul_a * mul_b, and the product is on mul_y
+	// in the next cycle. The core never has a MUL and an audio instruction
+	// in flight at the same time, so no arbitration is needed. Without
+	// SHARED_MUL the ports are ignored and no operand mux is built.
+	input             mul_req,
+	input      [32:0] mul_a,
+	input      [32:0] mul_b,
+	output     [63:0] mul_y
 );
 	reg instr_mul, instr_mulh, instr_mulhsu, instr_mulhu;
 	wire instr_any_mul = |{instr_mul, instr_mulh, instr_mulhsu, instr_mulhu};
@@ -2375,6 +2591,8 @@ module picorv32_pcpi_fast_mul #(
 	wire pcpi_insn_valid = pcpi_valid && pcpi_insn[6:0] == 7'b0110011 && pcpi_insn[31:25] == 7'b0000001;
 	reg pcpi_insn_valid_q;
 
+	wire shared_req = SHARED_MUL && mul_req;
+
 	always @* begin
 		instr_mul = 0;
 		instr_mulh = 0;
@@ -2397,8 +2615,8 @@ module picorv32_pcpi_fast_mul #(
 			rs1_q <= rs1;
 			rs2_q <= rs2;
 		end
-		if (!MUL_CLKGATE || active[1]) begin
-			rd <= $signed(EXTRA_MUL_FFS ? rs1_q : rs1) * $signed(EXTRA_MUL_FFS ? rs2_q : rs2);
+		if (!MUL_CLKGATE || active[1] || shared_req) begin
+			rd <= $signed(shared_req ? mul_a : EXTRA_MUL_FFS ? rs1_q : rs1) * $signed(shared_req ? mul_b : EXTRA_MUL_FFS ? rs2_q : rs2);
 		end
 		if (!MUL_CLKGATE || active[2]) begin
 			rd_q <= rd;
@@ -2428,6 +2646,8 @@ module picorv32_pcpi_fast_mul #(
 			active <= 0;
 	end
 
+	assign mul_y = rd;
+
 	assign pcpi_wr = active[EXTRA_MUL_FFS ? 3 : 1];
 	assign pcpi_wait = 0;
 	assign pcpi_ready = active[EXTRA_MUL_FFS ? 3 : 1];
@@ -2552,15 +2772,85 @@ endmodule
 	 *   0x21: MSUB16  - 2x16-bit signed MSUB
 	 *   0x22: ABS16   - lane-wise 16-bit absolute value (saturating)
 	 *   0x23: CONV4   - 4x8-bit dot product
-	 *   0x24: CONV8   - currently same as CONV4
-	 *   0x25: LMSSTEP - currently same as MAC16
+	 *   0x24: CONV8   - 8-tap 8-bit FIR over an internal delay line
+	 *                   (funct3 selects WORD/SETH/PUSH/CLR, see below)
+	 *   0x25: LMSSTEP - N-tap adaptive FIR, predict and coefficient update
+	 *                   (funct3 selects STEP/SETC/GETC/CFG/CLR, see below)
 	 *   0x26: CMAC    - complex 16-bit multiply (saturating, packed)
 	 *   0x27: ABS2    - complex magnitude squared (16-bit lanes)
 	 *   0x28: CLIP16  - 16-bit lane-wise symmetric clipping
 	 *   0x29: SHIFTN  - signed fixed-point scaling shift with rounding
+	 *                   (funct3 selects the rounding and a 64-bit input)
+	 *   0x2A: MACA    - accumulate MAC16/CONV4 into a 40-bit accumulator
+	 *   0x2B: ACCRD   - read accumulator with round, shift and saturate
+	 *   0x2C: ACCCLR  - clear or set an accumulator
+	 *                   (funct3[1:0] selects one of four accumulators)
+	 *   0x2D: BIQUAD  - second-order IIR section, transposed direct form II
+	 *                   (funct3 selects STEP/SETC/CLR, see below)
+	 *   0x2E: BFLY    - radix-2 FFT butterfly a +/- w*b on packed Q15 complex
+	 *                   (funct3 selects TW/TWK/BFLY/SCALE/DIFF, see below)
+	 *   0x2F: LANE16  - packed 16-bit lane ops (funct3 selects ADD16S/
+	 *                   SUB16S/PKLO/PKHI/SXTLO/SXTHI)
+	 *   0x30: MULQ15  - dual-lane Q15 multiply with saturation
+	 *                   (funct3 = 1: MULQ15R, rounded)
+	 *   0x31: NORM    - iterative RECIP/RSQRT/SQRT (funct3 selects)
+	 *   0x32: LOG2Q   - log2 of an unsigned integer, Q8.8
+	 *                   (funct3 = 1: EXP2Q, the inverse)
+	 *   0x33: CIRC    - circular-buffer address generator, four pointers
+	 *                   (funct3 selects NEXT/SETB/SETL/GETI/SETI/ADDR)
+	 *   0x34: MACC16  - rd += a0*b0 + a1*b1, rd read as a third source
+	 *   0x35: MSUBC16 - rd += a0*b0 - a1*b1, rd read as a third source
+	 *   0x36: MINMAX  - lane-wise 16-bit min/max and a decaying peak hold
+	 *                   (funct3 selects MIN16/MAX16/MAXABS16/PEAK/PKCFG/
+	 *                   PKCLR)
+	 *   0x37: ENVF    - envelope follower, four channels with attack/release
+	 *                   shifts (funct3 selects LVL/ABS/SQ/CFG/SET)
+	 *   0x38: CORDIC  - iterative sin/cos, atan2 and magnitude
+	 *                   (funct3 selects SINCOS/ATAN2/MAG)
+	 *   0x39: MEDIAN  - running 3- or 5-tap median over an internal window
+	 *                   (funct3 selects MED3/MED5/CLR)
+	 *   0x3A: LERP16  - Q15 linear interpolation, rounded and saturating
+	 *                   (funct3 = 1: LERP16.X2, both lanes)
+	 *   0x3B: AREG    - audio register file, moves and compute on areg[k]
+	 *                   (funct3 selects WRITE/READ/MAC16/MACC16/MULQ15R/
+	 *                   CONV4)
+	 *   0x3C: SATST   - sticky saturation flags, one per funct7
+	 *                   (funct3 selects READ/CLEAR)
+ *
+ * PIPELINE_STAGES selects the latency/fmax trade-off:
+ *   0: fully combinational, result in the cycle pcpi_valid is seen
+ *   1: operands are registered, the datapath runs from the registers
+ *   2: operands and results are registered
+ * While an instruction is in flight pcpi_wait is asserted.
+ *
+ * LMS_TAPS (clamped to 1..64) sizes the LMSSTEP coefficient bank. LMSSTEP is
+ * iterative: it takes one cycle per active tap plus two cycles.
+ *
+ * BIQUAD keeps Q1.14 coefficients b0,b1,b2,a1,a2 and the TDF-II state of
+ * four sections; one BIQUAD.STEP runs one section on a Q1.15 sample.
+ *
+ * BFLY returns a + w*b and keeps a - w*b for a following BFLY.DIFF, so a
+ * butterfly takes two issues. The twiddle w comes from a register (TW)
+ * or from a quarter-wave ROM of W256^k (TWK).
+ *
+ * NORM takes an unsigned Q15 operand and is iterative like
+ * picorv32_pcpi_div: RECIP takes 32 cycles, SQRT 24 and RSQRT 72.
+ * Every result is the exact value rounded down (error < 1 LSB).
+ *
+ * CIRC keeps base/length/index/element-size for four circular buffers.
+ * PCPI has no memory port, so CIRC.NEXT returns the address of the
+ * current element and advances the index; the core then uses lw/lh/lb.
  ***************************************************************/
 
-module picorv32_pcpi_audio (
+module picorv32_pcpi_audio #(
+	parameter PIPELINE_STAGES = 0,
+	parameter LMS_TAPS = 16,
+	parameter CORDIC_ITERS = 16,
+	parameter AREGS = 16,
+	parameter [31:0] OPS = 32'hffff_ffff,
+	parameter WITH_RS3 = 1,
+	parameter SHARED_MUL = 0
+) (
 	input             clk,
 	input             resetn,
 
@@ -2568,18 +2858,550 @@ module picorv32_pcpi_audio (
 	input      [31:0] pcpi_insn,
 	input      [31:0] pcpi_rs1,
 	input      [31:0] pcpi_rs2,
+	input      [31:0] pcpi_rs3,   // current value of rd (MACC16/MSUBC16)
 	output            pcpi_wr,
 	output     [31:0] pcpi_rd,
 	output            pcpi_wait,
-	output            pcpi_ready
+	output            pcpi_ready,
+
+	// Fast path: the core offers an AUX op with funct7 0x20..0x2F,
+	// 0x34..0x37 or 0x39..0x3F straight from its register file
+	// (instruction on pcpi_insn). Single-cycle ops are executed in that cycle and
+	// fast_ready is returned together with pcpi_wr/pcpi_rd; the rest are
+	// left to the PCPI handshake. Only used with PIPELINE_STAGES = 0.
+	input             fast_valid,
+	input      [31:0] fast_rs1,
+	input      [31:0] fast_rs2,
+	input      [31:0] fast_rs3,
+	output            fast_ready,
+
+	// Multiplier of picorv32_pcpi_fast_mul, used when SHARED_MUL is set.
+	// The product of mul_a and mul_b is on mul_y one cycle after mul_req.
+	output            mul_req,
+	output     [32:0] mul_a,
+	output     [32:0] mul_b,
+	input      [63:0] mul_y
 );
 	localparam [6:0] OPC_CUSTOM0 = 7'b0001011;
 
-	wire is_custom0 = pcpi_insn[6:0] == OPC_CUSTOM0;
-	wire [6:0] funct7 = pcpi_insn[31:25];
+	// CONV8 sub-operations (funct3)
+	localparam [2:0] CONV8_WORD = 3'b000;
+	localparam [2:0] CONV8_SETH = 3'b001;
+	localparam [2:0] CONV8_PUSH = 3'b010;
+	localparam [2:0] CONV8_CLR  = 3'b011;
+
+	// LMSSTEP sub-operations (funct3)
+	localparam [2:0] LMS_STEP = 3'b000;
+	localparam [2:0] LMS_SETC = 3'b001;
+	localparam [2:0] LMS_GETC = 3'b010;
+	localparam [2:0] LMS_CFG  = 3'b011;
+	localparam [2:0] LMS_CLR  = 3'b100;
+
+	// SHIFTN rounding modes (funct3[1:0]); funct3[2] selects the 64-bit
+	// form. Mode 0 is the original SHIFTN.
+	localparam [1:0] SHN_AWAY  = 2'b00;
+	localparam [1:0] SHN_TRUNC = 2'b01;
+	localparam [1:0] SHN_EVEN  = 2'b10;
+
+	// BIQUAD sub-operations (funct3)
+	localparam [2:0] BQ_STEP = 3'b000;
+	localparam [2:0] BQ_SETC = 3'b001;
+	localparam [2:0] BQ_CLR  = 3'b010;
+
+	// BFLY sub-operations (funct3)
+	localparam [2:0] BFLY_TW    = 3'b000;
+	localparam [2:0] BFLY_TWK   = 3'b001;
+	localparam [2:0] BFLY_SUM   = 3'b010;
+	localparam [2:0] BFLY_SCALE = 3'b011;
+	localparam [2:0] BFLY_DIFF  = 3'b100;
+
+	// LANE16 sub-operations (funct3)
+	localparam [2:0] L16_ADD16S = 3'b000;
+	localparam [2:0] L16_SUB16S = 3'b001;
+	localparam [2:0] L16_PKLO   = 3'b010;
+	localparam [2:0] L16_PKHI   = 3'b011;
+	localparam [2:0] L16_SXTLO  = 3'b100;
+	localparam [2:0] L16_SXTHI  = 3'b101;
+
+	// MULQ15 sub-operations (funct3)
+	localparam [2:0] MULQ15_TRUNC = 3'b000;
+	localparam [2:0] MULQ15_RND   = 3'b001;
+
+	// NORM sub-operations (funct3)
+	localparam [2:0] NORM_RECIP = 3'b000;
+	localparam [2:0] NORM_RSQRT = 3'b001;
+	localparam [2:0] NORM_SQRT  = 3'b010;
+
+	// LOG2Q sub-operations (funct3)
+	localparam [2:0] LOG2_LOG = 3'b000;
+	localparam [2:0] LOG2_EXP = 3'b001;
+
+	// CIRC sub-operations (funct3)
+	localparam [2:0] CIRC_NEXT = 3'b000;
+	localparam [2:0] CIRC_SETB = 3'b001;
+	localparam [2:0] CIRC_SETL = 3'b010;
+	localparam [2:0] CIRC_GETI = 3'b011;
+	localparam [2:0] CIRC_SETI = 3'b100;
+	localparam [2:0] CIRC_ADDR = 3'b101;
+
+	// MINMAX sub-operations (funct3)
+	localparam [2:0] MM_MIN16    = 3'b000;
+	localparam [2:0] MM_MAX16    = 3'b001;
+	localparam [2:0] MM_MAXABS16 = 3'b010;
+	localparam [2:0] MM_PEAK     = 3'b011;
+	localparam [2:0] MM_PKCFG    = 3'b100;
+	localparam [2:0] MM_PKCLR    = 3'b101;
+
+	// ENVF sub-operations (funct3)
+	localparam [2:0] ENVF_LVL = 3'b000;
+	localparam [2:0] ENVF_ABS = 3'b001;
+	localparam [2:0] ENVF_SQ  = 3'b010;
+	localparam [2:0] ENVF_CFG = 3'b011;
+	localparam [2:0] ENVF_SET = 3'b100;
+
+	// CORDIC sub-operations (funct3)
+	localparam [2:0] COR_SINCOS = 3'b000;
+	localparam [2:0] COR_ATAN2  = 3'b001;
+	localparam [2:0] COR_MAG    = 3'b010;
+
+	// MEDIAN sub-operations (funct3)
+	localparam [2:0] MED_3   = 3'b000;
+	localparam [2:0] MED_5   = 3'b001;
+	localparam [2:0] MED_CLR = 3'b010;
+
+	// LERP16 variants (funct3)
+	localparam [2:0] LERP_PAIR = 3'b000;
+	localparam [2:0] LERP_X2   = 3'b001;
+
+	// AREG sub-operations (funct3). The audio register number is the rs2
+	// field of the instruction.
+	localparam [2:0] AR_WRITE  = 3'b000;
+	localparam [2:0] AR_READ   = 3'b001;
+	localparam [2:0] AR_MAC16  = 3'b010;
+	localparam [2:0] AR_MACC16 = 3'b011;
+	localparam [2:0] AR_MULQ15 = 3'b100;
+	localparam [2:0] AR_CONV4  = 3'b101;
+
+	// SATST sub-operations (funct3)
+	localparam [2:0] SAT_READ  = 3'b000;
+	localparam [2:0] SAT_CLEAR = 3'b001;
+
+	// Per-op enables: OPS bit n enables funct7 0x20 + n. A disabled op is
+	// not decoded, so the core traps on it, and its datapath and state are
+	// removed by synthesis.
+	localparam HAS_MAC16   = OPS[0];
+	localparam HAS_MSUB16  = OPS[1];
+	localparam HAS_ABS16   = OPS[2];
+	localparam HAS_CONV4   = OPS[3];
+	localparam HAS_CONV8   = OPS[4];
+	localparam HAS_LMS     = OPS[5];
+	localparam HAS_CMAC    = OPS[6];
+	localparam HAS_ABS2    = OPS[7];
+	localparam HAS_CLIP16  = OPS[8];
+	localparam HAS_SHIFTN  = OPS[9];
+	localparam HAS_MACA    = OPS[10];
+	localparam HAS_ACCRD   = OPS[11];
+	localparam HAS_ACCCLR  = OPS[12];
+	localparam HAS_BIQUAD  = OPS[13];
+	localparam HAS_BFLY    = OPS[14];
+	localparam HAS_LANE16  = OPS[15];
+	localparam HAS_MULQ15  = OPS[16];
+	localparam HAS_NORM    = OPS[17];
+	localparam HAS_LOG2Q   = OPS[18];
+	localparam HAS_CIRC    = OPS[19];
+	localparam HAS_MACC16  = OPS[20];
+	localparam HAS_MSUBC16 = OPS[21];
+	localparam HAS_MINMAX  = OPS[22];
+	localparam HAS_ENVF    = OPS[23];
+	localparam HAS_CORDIC  = OPS[24];
+	localparam HAS_MEDIAN  = OPS[25];
+	localparam HAS_LERP16  = OPS[26];
+	localparam HAS_AREG    = OPS[27];
+	localparam HAS_SATST   = OPS[28];
+
+	// Returns 1 for every funct7/funct3 pair implemented by this unit.
+	// The original single-function ops ignore funct3.
+	function audio_op_known;
+		input [6:0] f7;
+		input [2:0] f3;
+	begin
+		audio_op_known = 0;
+		if (f7 >= 7'h20 && f7 <= 7'h3C && OPS[f7[4:0]]) begin
+			case (f7)
+				7'h24:   audio_op_known = f3 <= CONV8_CLR;
+				7'h29:   audio_op_known = f3[1:0] != 2'b11 && (WITH_RS3 || !f3[2]);
+				7'h25:   audio_op_known = f3 <= LMS_CLR;
+				7'h2D:   audio_op_known = f3 <= BQ_CLR;
+				7'h2E:   audio_op_known = f3 <= BFLY_DIFF;
+				7'h2F:   audio_op_known = f3 <= L16_SXTHI;
+				7'h30:   audio_op_known = f3 <= MULQ15_RND;
+				7'h31:   audio_op_known = f3 <= NORM_SQRT;
+				7'h32:   audio_op_known = f3 <= LOG2_EXP;
+				7'h33:   audio_op_known = f3 <= CIRC_ADDR;
+				7'h34:   audio_op_known = WITH_RS3 && f3 == 0;
+				7'h35:   audio_op_known = WITH_RS3 && f3 == 0;
+				7'h36:   audio_op_known = f3 <= MM_PKCLR;
+				7'h37:   audio_op_known = f3 <= ENVF_SET;
+				7'h38:   audio_op_known = f3 <= COR_MAG;
+				7'h39:   audio_op_known = f3 <= MED_CLR;
+				7'h3A:   audio_op_known = f3 == LERP_PAIR || WITH_RS3 && f3 == LERP_X2;
+				7'h3B:   audio_op_known = f3 <= AR_CONV4 && (WITH_RS3 || f3 != AR_MACC16);
+				7'h3C:   audio_op_known = f3 <= SAT_CLEAR;
+				default: audio_op_known = 1;
+			endcase
+		end
+	end
+	endfunction
+
+	// Ops that run on the shared multiplier (MAC16, MSUB16, MACC16 and
+	// MSUBC16) when SHARED_MUL is set. All other multipliers stay private;
+	// MACA and MULQ15 form the same rs1 x rs2 lane products, so the pair
+	// is only removed in builds without them.
+	function audio_op_shared;
+		input [6:0] f7;
+	begin
+		audio_op_shared = SHARED_MUL && (f7[6:1] == 6'b010000 || f7[6:1] == 6'b011010);
+	end
+	endfunction
+
+	wire pcpi_insn_valid = resetn && pcpi_valid && pcpi_insn[6:0] == OPC_CUSTOM0 &&
+			audio_op_known(pcpi_insn[31:25], pcpi_insn[14:12]);
+
+	// An instruction is "busy" from the cycle it is accepted until the
+	// cycle pcpi_ready is returned. The core drops pcpi_valid in the cycle
+	// after pcpi_ready, so this also prevents accepting it a second time.
+	reg busy;
+	wire accept = pcpi_insn_valid && !busy;
+
+	// LMSSTEP (0x25) is iterative and stays on the PCPI path, as do the
+	// ops sequenced on the shared multiplier.
+	wire fast_accept = PIPELINE_STAGES == 0 && resetn && fast_valid && !busy && pcpi_insn[6:0] == OPC_CUSTOM0 &&
+			(pcpi_insn[31:28] == 4'b0010 && pcpi_insn[31:25] != 7'h25 || pcpi_insn[31:27] == 5'b01101 ||
+			 pcpi_insn[31:28] == 4'b0111 && pcpi_insn[31:25] != 7'h38) && !audio_op_shared(pcpi_insn[31:25]) && audio_op_known(pcpi_insn[31:25], pcpi_insn[14:12]);
+
+	// Execute stage: the instruction and operands the datapath works on.
+	reg        op_valid;
+	reg [31:0] op_insn, op_rs1, op_rs2, op_rs3;
+
+	wire        exec_valid = PIPELINE_STAGES ? op_valid : accept || fast_accept;
+	wire [31:0] exec_insn  = PIPELINE_STAGES ? op_insn  : pcpi_insn;
+	wire [31:0] exec_rs1   = PIPELINE_STAGES ? op_rs1   : fast_accept ? fast_rs1 : pcpi_rs1;
+	wire [31:0] exec_rs2   = PIPELINE_STAGES ? op_rs2   : fast_accept ? fast_rs2 : pcpi_rs2;
+	wire [31:0] exec_rs3   = PIPELINE_STAGES ? op_rs3   : fast_accept ? fast_rs3 : pcpi_rs3;
+	wire [6:0]  funct7     = exec_insn[31:25];
+	wire [2:0]  funct3     = exec_insn[14:12];
 
 	reg [31:0] result;
 	reg        result_valid;
+	reg        result_wr;
+	reg        result_sat;
+
+	// Output stage (PIPELINE_STAGES >= 2)
+	reg        res_valid;
+	reg        res_wr;
+	reg [31:0] res_rd;
+
+	// CONV8 state: 8-sample delay line, byte 0 holds the newest sample and
+	// byte 7 the oldest. The newest four samples are weighted by rs2, the
+	// oldest four by conv8_coef (taps h4..h7, set with CONV8.SETH).
+	reg [63:0] conv8_line;
+	reg [31:0] conv8_coef;
+
+	// Delay line contents including the sample(s) of this instruction.
+	wire [63:0] conv8_next = funct3 == CONV8_PUSH ? {conv8_line[55:0], exec_rs1[7:0]} :
+			{conv8_line[31:0], exec_rs1};
+
+	// LMS_TAPS clamped to 1..64: lms_idx (rs1[5:0]) addresses at most 64
+	// coefficients.
+	localparam LMS_N = LMS_TAPS < 1 ? 1 : LMS_TAPS > 64 ? 64 : LMS_TAPS;
+
+	// LMS state. lms_x[j] holds x[n-j]; one extra entry keeps x[n-1-k] for
+	// the update of the last tap. lms_g is mu*e of the previous step, so
+	// the update runs in the same pass as the prediction (delayed LMS):
+	//   y[n]  = sum c[k]*x[n-k]                  (Q15 coefficients)
+	//   c[k] += (g * x[n-1-k]) >> shift,  g = (mu * e[n-1]) >> 15
+	//   e[n]  = d[n] - y[n]
+	reg signed [15:0] lms_x [0:LMS_N];
+	reg signed [15:0] lms_c [0:LMS_N-1];
+	reg signed [15:0] lms_mu, lms_g, lms_d;
+	reg        [ 4:0] lms_shift;
+	reg        [ 6:0] lms_len, lms_k;
+	reg signed [39:0] lms_acc;
+	reg        lms_run, lms_fin, lms_done;
+	reg [31:0] lms_rd;
+	integer i;
+
+	wire [5:0] lms_idx = exec_rs1[5:0];
+	wire lms_idx_ok = exec_rs1 < LMS_N;
+
+	wire signed [31:0] lms_prod = lms_c[lms_k] * lms_x[lms_k];
+	wire signed [31:0] lms_grad = lms_g * lms_x[lms_k + 1];
+	wire signed [31:0] lms_delta = lms_shift ? (lms_grad + (32'sd1 <<< (lms_shift - 1))) >>> lms_shift : lms_grad;
+
+	wire signed [39:0] lms_acc_rnd = (lms_acc + 40'sd16384) >>> 15;
+	wire signed [15:0] lms_y = sat16_from32(lms_acc_rnd[31:0]);
+	wire signed [31:0] lms_err = lms_d - lms_y;
+	wire signed [15:0] lms_e = sat16_from32(lms_err);
+	wire signed [31:0] lms_mue = lms_mu * $signed(lms_rd[31:16]) + 32'sd16384;
+	wire signed [15:0] lms_g_next = sat16_from32(lms_mue >>> 15);
+
+	// Wide accumulators for MACA/ACCRD/ACCCLR. funct3[1:0] is the index,
+	// funct3[2] selects the CONV4 (MACA), 16-bit (ACCRD) or set (ACCCLR)
+	// variant. 40 bits take 255 worst-case MAC16 results (|a0*b0 + a1*b1|
+	// <= 2^31) before they can wrap.
+	reg signed [39:0] accum [0:3];
+
+	wire [1:0] acc_sel = funct3[1:0];
+	wire signed [32:0] acc_prod = funct3[2] ? $signed(conv4_8bit(exec_rs1, exec_rs2)) :
+			mac16_wide(exec_rs1, exec_rs2, 0);
+	wire signed [39:0] acc_sum = accum[acc_sel] + acc_prod;
+
+	// MACC16/MSUBC16: rd + MAC16/MSUB16 of rs1, rs2, saturated to 32 bits.
+	// funct7[0] selects MSUBC16.
+	wire signed [32:0] macc_prod = mac16_wide(exec_rs1, exec_rs2, funct7[0]);
+	wire signed [40:0] macc_sum = $signed(exec_rs3) + macc_prod;
+
+	// PEAKHOLD state: one peak magnitude per 16-bit lane. Each PEAKHOLD
+	// first decays it by pk_decay (peak -= peak >> pk_decay, 0 = hold),
+	// then raises it to |rs1| where that is larger.
+	reg [31:0] pk_val;
+	reg [ 3:0] pk_decay;
+
+	wire [31:0] pk_abs = abs16_lanes(exec_rs1);
+	wire [31:0] pk_dec = !pk_decay ? pk_val :
+			{pk_val[31:16] - (pk_val[31:16] >> pk_decay), pk_val[15:0] - (pk_val[15:0] >> pk_decay)};
+	wire [31:0] pk_next = umax16_lanes(pk_abs, pk_dec);
+
+	// ENVF state: one envelope per channel (rs2[1:0]), each with its own
+	// attack and release shift. A step moves the envelope towards the
+	// input by (input - env) >> shift, rounded like SHIFTN, so it never
+	// overshoots and stays within the range of its inputs.
+	reg [31:0] envf_val [0:3];
+	reg [ 4:0] envf_att [0:3];
+	reg [ 4:0] envf_rel [0:3];
+
+	wire [ 1:0] envf_ch = exec_rs2[1:0];
+	wire [31:0] envf_abs = abs16_lanes(exec_rs1);
+	wire signed [31:0] envf_sq = $signed(exec_rs1[15:0]) * $signed(exec_rs1[15:0]);
+	wire [31:0] envf_in = funct3 == ENVF_ABS ? {16'b0, envf_abs[15:0]} :
+			funct3 == ENVF_SQ ? envf_sq : exec_rs1;
+	wire signed [32:0] envf_d = {1'b0, envf_in} - {1'b0, envf_val[envf_ch]};
+	wire [ 4:0] envf_k = envf_d[32] ? envf_rel[envf_ch] : envf_att[envf_ch];
+	wire [32:0] envf_mag = envf_d[32] ? -envf_d : envf_d;
+	wire [32:0] envf_step = envf_k ? (envf_mag + (33'd1 << (envf_k - 1))) >> envf_k : envf_mag;
+	wire [31:0] envf_next = envf_d[32] ? envf_val[envf_ch] - envf_step : envf_val[envf_ch] + envf_step;
+
+	// SHARED_MUL: the same ops without private multipliers. a0*b0 is
+	// issued in the execute cycle, a1*b1 in the next one, and rd is
+	// written in the third cycle from the two products.
+	reg  [ 1:0] smul_st;
+	reg  [15:0] smul_a1, smul_b1;
+	reg  [31:0] smul_rs3, smul_p0;
+	reg         smul_sub, smul_acc;
+
+	wire smul_start = exec_valid && audio_op_shared(funct7);
+	wire smul_done = smul_st == 2;
+	wire signed [32:0] smul_prod = smul_sub ? $signed(smul_p0) - $signed(mul_y[31:0]) :
+			$signed(smul_p0) + $signed(mul_y[31:0]);
+	wire signed [40:0] smul_sum = $signed(smul_rs3) + smul_prod;
+	wire        [31:0] smul_rd = smul_acc ? sat_from41(smul_sum, 0) : smul_prod[31:0];
+
+	assign mul_req = smul_start || smul_st == 1;
+	assign mul_a = smul_st == 1 ? {{17{smul_a1[15]}}, smul_a1} : {{17{exec_rs1[15]}}, exec_rs1[15:0]};
+	assign mul_b = smul_st == 1 ? {{17{smul_b1[15]}}, smul_b1} : {{17{exec_rs2[15]}}, exec_rs2[15:0]};
+
+	// SHIFTN: rs1 >>> rs2[4:0], or with funct3[2] the 64-bit {rs2, rs1}
+	// >>> rd[5:0], saturated to 32 bits (16 bits with rd[8] set). rd is
+	// read as a third source for the control word, as in MACC16.
+	wire        shn_wide = funct3[2];
+	wire        shn_narrow = exec_rs3[8];
+	wire [63:0] shn_x = shn_wide ? {exec_rs2, exec_rs1} : {{32{exec_rs1[31]}}, exec_rs1};
+	wire [ 5:0] shn_sh = shn_wide ? exec_rs3[5:0] : {1'b0, exec_rs2[4:0]};
+	wire [63:0] shn_q = shiftn_round(shn_x, shn_sh, funct3[1:0]);
+
+	// ACCRD: round half up, arithmetic shift right by rs1[5:0] (max 39).
+	wire [5:0] acc_shamt = exec_rs1[5:0] > 39 ? 6'd39 : exec_rs1[5:0];
+	wire signed [40:0] acc_biased = accum[acc_sel] +
+			(acc_shamt ? 41'sd1 <<< (acc_shamt - 1) : 41'sd0);
+	wire signed [40:0] acc_scaled = acc_biased >>> acc_shamt;
+
+	// BIQUAD state, transposed direct form II per section:
+	//   y  = b0*x + s1
+	//   s1 = b1*x - a1*y + s2
+	//   s2 = b2*x - a2*y
+	// Coefficients are Q1.14, samples Q1.15 and s1/s2 are kept as
+	// saturated Q3.29 so rounding only happens once, at the output.
+	reg signed [15:0] bq_b0 [0:3];
+	reg signed [15:0] bq_b1 [0:3];
+	reg signed [15:0] bq_b2 [0:3];
+	reg signed [15:0] bq_a1 [0:3];
+	reg signed [15:0] bq_a2 [0:3];
+	reg signed [31:0] bq_s1 [0:3];
+	reg signed [31:0] bq_s2 [0:3];
+
+	// STEP: rs1[15:0] = x, rs2[1:0] = section.
+	// SETC: rs1 = 8*section + k (k = b0,b1,b2,a1,a2), rs2[15:0] = value.
+	wire [1:0] bq_sec = funct3 == BQ_STEP ? exec_rs2[1:0] : exec_rs1[4:3];
+	wire [2:0] bq_k = exec_rs1[2:0];
+	wire signed [15:0] bq_x = exec_rs1[15:0];
+
+	wire signed [31:0] bq_b0x = bq_b0[bq_sec] * bq_x;
+	wire signed [31:0] bq_b1x = bq_b1[bq_sec] * bq_x;
+	wire signed [31:0] bq_b2x = bq_b2[bq_sec] * bq_x;
+	wire signed [32:0] bq_acc = bq_b0x + bq_s1[bq_sec] + 33'sd8192;
+	wire signed [32:0] bq_yw = bq_acc >>> 14;
+	wire signed [15:0] bq_y = sat16_from32(bq_yw[31:0]);
+
+	wire signed [31:0] bq_a1y = bq_a1[bq_sec] * bq_y;
+	wire signed [31:0] bq_a2y = bq_a2[bq_sec] * bq_y;
+	wire signed [33:0] bq_s1_next = bq_b1x - bq_a1y + bq_s2[bq_sec];
+	wire signed [33:0] bq_s2_next = bq_b2x - bq_a2y;
+
+	// BFLY state: the twiddle (packed {im, re} Q15, reset to 1+0j) and the
+	// a - w*b half of the last butterfly.
+	reg [31:0] bfly_w;
+	reg [31:0] bfly_diff;
+
+	// W256^k = cos(2*pi*k/256) - j*sin(2*pi*k/256) for k = rs1[6:0].
+	wire [6:0]  bfly_k = exec_rs1[6:0];
+	wire [15:0] bfly_sin = bfly_sin_quarter(bfly_k <= 64 ? bfly_k : 128 - bfly_k);
+	wire [15:0] bfly_cos_q = bfly_sin_quarter(bfly_k <= 64 ? 64 - bfly_k : bfly_k - 64);
+	wire [15:0] bfly_cos = bfly_k <= 64 ? bfly_cos_q : -bfly_cos_q;
+	wire [31:0] bfly_rom_w = {-bfly_sin, bfly_cos};
+
+	// a*2^15 + w*b per lane, rounded once; SCALE adds one more right shift.
+	wire bfly_shift = funct3 == BFLY_SCALE;
+	wire [31:0] bfly_sum  = bfly_out(exec_rs1, exec_rs2, bfly_w, 0, bfly_shift);
+	wire [31:0] bfly_diff_next = bfly_out(exec_rs1, exec_rs2, bfly_w, 1, bfly_shift);
+
+	// NORM engine, x = rs1 as unsigned Q15:
+	//   RECIP: rd = 2^31 / x             (1/x in Q16.16)
+	//   SQRT:  rd = sqrt(x * 2^15)       (sqrt(x) in Q15)
+	//   RSQRT: rd = sqrt(2^47 / x)       (1/sqrt(x) in Q16.16)
+	// A restoring division of 2^K by x runs one quotient bit per cycle,
+	// then a digit-by-digit square root one result bit per cycle. Both
+	// truncate, and floor(sqrt(floor(y))) == floor(sqrt(y)), so RSQRT is
+	// also exact to within 1 LSB.
+	reg        nrm_div, nrm_sqrt, nrm_then_sqrt, nrm_done;
+	reg [ 5:0] nrm_cnt;
+	reg [31:0] nrm_den;
+	reg [32:0] nrm_rem;
+	reg [47:0] nrm_quo;
+	reg [47:0] nrm_sq_op, nrm_sq_res, nrm_sq_one;
+	reg [31:0] nrm_rd;
+
+	wire        nrm_ge = nrm_rem >= nrm_den;
+	wire [47:0] nrm_quo_next = {nrm_quo[46:0], nrm_ge};
+	wire [32:0] nrm_rem_next = nrm_ge ? nrm_rem - nrm_den : nrm_rem;
+
+	wire [48:0] nrm_sq_try = nrm_sq_res + nrm_sq_one;
+	wire        nrm_sq_ge = nrm_sq_op >= nrm_sq_try;
+	wire [47:0] nrm_sq_res_next = nrm_sq_ge ? (nrm_sq_res >> 1) + nrm_sq_one : nrm_sq_res >> 1;
+
+	// MEDIAN window: the last five samples, the newest in bits 15:0. MED3
+	// and MED5 push rs1[15:0] and return the median of the newest three
+	// or all five samples, including the new one.
+	reg  [79:0] med_win;
+	wire [79:0] med_next = {med_win[63:0], exec_rs1[15:0]};
+	wire [15:0] med_sel = median16(med_next, funct3 == MED_5);
+
+	// LERP16 lanes: lane 0 is the pair form ({b, a} in rs1, frac in rs2)
+	// or the low lane of X2, lane 1 the high lane of X2.
+	wire lerp_x2 = funct3 == LERP_X2;
+	wire signed [31:0] lerp_w0 = lerp16_wide(exec_rs1[15:0], lerp_x2 ? exec_rs2[15:0] : exec_rs1[31:16],
+			lerp_x2 ? exec_rs3[15:0] : exec_rs2[15:0]);
+	wire signed [31:0] lerp_w1 = lerp16_wide(exec_rs1[31:16], exec_rs2[31:16], exec_rs3[15:0]);
+	wire [15:0] lerp_y0 = sat16_from32(lerp_w0);
+	wire [15:0] lerp_y1 = sat16_from32(lerp_w1);
+
+	// Wide results shared by an op's saturated value and its SATST flag.
+	wire [63:0] cmac_y = cmac_wide(exec_rs1, exec_rs2);
+	wire [31:0] clip_y = clip16_lanes(exec_rs1, exec_rs2);
+	wire signed [16:0] addsub_y0, addsub_y1;
+	assign {addsub_y1, addsub_y0} = addsub16_wide(exec_rs1, exec_rs2, funct3[0]);
+
+	// Audio register file: AREGS (1..16) words for coefficients and
+	// constants, so kernels need neither integer registers nor loads for
+	// them. The AREG compute variants use areg[k] in place of rs2.
+	// Numbers >= AREGS read as 0 and ignore writes.
+	localparam AR_N = AREGS < 1 ? 1 : AREGS > 16 ? 16 : AREGS;
+
+	reg  [31:0] areg [0:AR_N-1];
+
+	wire [ 3:0] areg_k = exec_insn[23:20];
+	wire [31:0] areg_rd = areg_k < AR_N ? areg[areg_k] : 32'd0;
+	wire signed [40:0] areg_macc = $signed(exec_rs3) + mac16_wide(exec_rs1, areg_rd, 0);
+
+	// Sticky saturation flags: bit n is set when an op with funct7
+	// 0x20 + n clipped its result (or, for BIQUAD, its state). Only SATST
+	// clears them, so firmware can check once per block.
+	reg  [31:0] sat_flags;
+
+	// CORDIC engine, one iteration per cycle. Angles are kept with
+	// pi = 2^20, x/y with COR_G guard bits below Q15.
+	//   SINCOS (rotation):  x = 1/K, y = 0, z = phase  ->  x = cos, y = sin
+	//   ATAN2/MAG (vectoring): x + jy = rs1, z = 0  ->  z = angle, x = K*|rs1|
+	// Inputs outside +-pi/2 are first rotated by pi. The iteration count
+	// trades accuracy (about 2^-COR_N of pi) for latency; the area is the
+	// same apart from the atan table.
+	localparam COR_N = CORDIC_ITERS < 4 ? 4 : CORDIC_ITERS > 20 ? 20 : CORDIC_ITERS;
+	localparam COR_G = 6;
+	localparam signed [25:0] COR_INVK = 26'sd1273502;  // round(2^21 / K)
+	localparam        [15:0] COR_INVK16 = 16'd39797;   // round(2^16 / K)
+	localparam signed [22:0] COR_PI = 23'sd1048576;
+	localparam signed [22:0] COR_PI_2 = 23'sd524288;
+
+	reg        cor_run, cor_fin, cor_done;
+	reg [ 2:0] cor_op;
+	reg [ 4:0] cor_i;
+	reg signed [25:0] cor_x, cor_y;
+	reg signed [22:0] cor_z;
+	reg [31:0] cor_rd;
+
+	// Rotate counter-clockwise: towards z = 0 (rotation) or y = 0 (vectoring).
+	wire cor_ccw = cor_op == COR_SINCOS ? !cor_z[22] : cor_y[25];
+	wire signed [25:0] cor_xs = cor_x >>> cor_i;
+	wire signed [25:0] cor_ys = cor_y >>> cor_i;
+	wire signed [22:0] cor_a = cordic_atan(cor_i);
+
+	wire signed [22:0] cor_phase = {{2{exec_rs1[15]}}, exec_rs1[15:0], 5'b0};
+	wire signed [25:0] cor_re = {{4{exec_rs1[15]}}, exec_rs1[15:0], 6'b0};
+	wire signed [25:0] cor_im = {{4{exec_rs1[31]}}, exec_rs1[31:16], 6'b0};
+
+	wire signed [31:0] cor_x_q15 = (cor_x + (26'sd1 <<< (COR_G-1))) >>> COR_G;
+	wire signed [31:0] cor_y_q15 = (cor_y + (26'sd1 <<< (COR_G-1))) >>> COR_G;
+	wire signed [22:0] cor_z_q15 = (cor_z + 23'sd16) >>> 5;
+	wire        [41:0] cor_mag = cor_x * COR_INVK16 + (42'd1 << (15 + COR_G));
+
+	// CIRC pointers. rs2[1:0] selects the pointer for every sub-op. NEXT
+	// and ADDR take a signed element offset in rs1 (|offset| <= length);
+	// the index wraps with one compare, no divider. Length 0 keeps the
+	// index at 0.
+	reg [31:0] circ_base [0:3];
+	reg [15:0] circ_len  [0:3];
+	reg [15:0] circ_idx  [0:3];
+	reg [ 1:0] circ_esz  [0:3];
+
+	wire [1:0] circ_p = exec_rs2[1:0];
+	wire signed [17:0] circ_sum = $signed({2'b00, circ_idx[circ_p]}) + $signed(exec_rs1[17:0]);
+	wire signed [17:0] circ_len_s = {2'b00, circ_len[circ_p]};
+	wire [15:0] circ_wrap = !circ_len[circ_p] ? 16'd0 :
+			circ_sum >= circ_len_s ? circ_sum - circ_len_s :
+			circ_sum < 0 ? circ_sum + circ_len_s : circ_sum;
+	wire [31:0] circ_cur_addr = circ_base[circ_p] + (circ_idx[circ_p] << circ_esz[circ_p]);
+	wire [31:0] circ_off_addr = circ_base[circ_p] + (circ_wrap << circ_esz[circ_p]);
+
+	reg signed [15:0] bq_coef;
+	always @* begin
+		case (bq_k)
+			0: bq_coef = bq_b0[bq_sec];
+			1: bq_coef = bq_b1[bq_sec];
+			2: bq_coef = bq_b2[bq_sec];
+			3: bq_coef = bq_a1[bq_sec];
+			4: bq_coef = bq_a2[bq_sec];
+			default: bq_coef = 0;
+		endcase
+	end
 
 	// Helper: saturate signed 32-bit to signed 16-bit.
 	function [15:0] sat16_from32;
@@ -2594,9 +3416,11 @@ module picorv32_pcpi_audio (
 	end
 	endfunction
 
-	// 2x16-bit MAC: (a0*b0 + a1*b1)
-	function [31:0] mac16;
+	// 2x16-bit MAC (a0*b0 + a1*b1) or MSUB (a0*b0 - a1*b1, sub = 1)
+	// with a 33-bit result, so -32768*-32768 twice cannot wrap.
+	function signed [32:0] mac16_wide;
 		input [31:0] rs1, rs2;
+		input sub;
 		reg  signed [15:0] a0, a1, b0, b1;
 		reg  signed [31:0] p0, p1;
 	begin
@@ -2606,13 +3430,174 @@ module picorv32_pcpi_audio (
 		b1 = rs2[31:16];
 		p0 = a0 * b0;
 		p1 = a1 * b1;
-		mac16 = p0 + p1;
+		mac16_wide = sub ? p0 - p1 : p0 + p1;
 	end
 	endfunction
 
-	// 2x16-bit MSUB: (a0*b0 - a1*b1)
-	function [31:0] msub16;
+	// 2x16-bit MAC: (a0*b0 + a1*b1)
+	function [31:0] mac16;
 		input [31:0] rs1, rs2;
+		reg  signed [32:0] y;
+	begin
+		y = mac16_wide(rs1, rs2, 0);
+		mac16 = y[31:0];
+	end
+	endfunction
+
+	// Helper: saturate a signed 41-bit value to signed 32-bit, or to
+	// signed 16-bit (sign-extended) when narrow is set.
+	function [31:0] sat_from41;
+		input signed [40:0] x;
+		input narrow;
+	begin
+		if (narrow) begin
+			if (x > 41'sd32767)
+				sat_from41 = 32'sd32767;
+			else if (x < -41'sd32768)
+				sat_from41 = -32'sd32768;
+			else
+				sat_from41 = x[31:0];
+		end else begin
+			if (x > 41'sd2147483647)
+				sat_from41 = 32'h7fffffff;
+			else if (x < -41'sd2147483648)
+				sat_from41 = 32'h80000000;
+			else
+				sat_from41 = x[31:0];
+		end
+	end
+	endfunction
+
+	// round(32767 * sin(2*pi*m/256)) for m = 0..64 (first quadrant).
+	function [15:0] bfly_sin_quarter;
+		input [6:0] m;
+	begin
+		case (m)
+			0: bfly_sin_quarter = 16'sd0;
+			1: bfly_sin_quarter = 16'sd804;
+			2: bfly_sin_quarter = 16'sd1608;
+			3: bfly_sin_quarter = 16'sd2410;
+			4: bfly_sin_quarter = 16'sd3212;
+			5: bfly_sin_quarter = 16'sd4011;
+			6: bfly_sin_quarter = 16'sd4808;
+			7: bfly_sin_quarter = 16'sd5602;
+			8: bfly_sin_quarter = 16'sd6393;
+			9: bfly_sin_quarter = 16'sd7179;
+			10: bfly_sin_quarter = 16'sd7962;
+			11: bfly_sin_quarter = 16'sd8739;
+			12: bfly_sin_quarter = 16'sd9512;
+			13: bfly_sin_quarter = 16'sd10278;
+			14: bfly_sin_quarter = 16'sd11039;
+			15: bfly_sin_quarter = 16'sd11793;
+			16: bfly_sin_quarter = 16'sd12539;
+			17: bfly_sin_quarter = 16'sd13279;
+			18: bfly_sin_quarter = 16'sd14010;
+			19: bfly_sin_quarter = 16'sd14732;
+			20: bfly_sin_quarter = 16'sd15446;
+			21: bfly_sin_quarter = 16'sd16151;
+			22: bfly_sin_quarter = 16'sd16846;
+			23: bfly_sin_quarter = 16'sd17530;
+			24: bfly_sin_quarter = 16'sd18204;
+			25: bfly_sin_quarter = 16'sd18868;
+			26: bfly_sin_quarter = 16'sd19519;
+			27: bfly_sin_quarter = 16'sd20159;
+			28: bfly_sin_quarter = 16'sd20787;
+			29: bfly_sin_quarter = 16'sd21403;
+			30: bfly_sin_quarter = 16'sd22005;
+			31: bfly_sin_quarter = 16'sd22594;
+			32: bfly_sin_quarter = 16'sd23170;
+			33: bfly_sin_quarter = 16'sd23731;
+			34: bfly_sin_quarter = 16'sd24279;
+			35: bfly_sin_quarter = 16'sd24811;
+			36: bfly_sin_quarter = 16'sd25329;
+			37: bfly_sin_quarter = 16'sd25832;
+			38: bfly_sin_quarter = 16'sd26319;
+			39: bfly_sin_quarter = 16'sd26790;
+			40: bfly_sin_quarter = 16'sd27245;
+			41: bfly_sin_quarter = 16'sd27683;
+			42: bfly_sin_quarter = 16'sd28105;
+			43: bfly_sin_quarter = 16'sd28510;
+			44: bfly_sin_quarter = 16'sd28898;
+			45: bfly_sin_quarter = 16'sd29268;
+			46: bfly_sin_quarter = 16'sd29621;
+			47: bfly_sin_quarter = 16'sd29956;
+			48: bfly_sin_quarter = 16'sd30273;
+			49: bfly_sin_quarter = 16'sd30571;
+			50: bfly_sin_quarter = 16'sd30852;
+			51: bfly_sin_quarter = 16'sd31113;
+			52: bfly_sin_quarter = 16'sd31356;
+			53: bfly_sin_quarter = 16'sd31580;
+			54: bfly_sin_quarter = 16'sd31785;
+			55: bfly_sin_quarter = 16'sd31971;
+			56: bfly_sin_quarter = 16'sd32137;
+			57: bfly_sin_quarter = 16'sd32285;
+			58: bfly_sin_quarter = 16'sd32412;
+			59: bfly_sin_quarter = 16'sd32521;
+			60: bfly_sin_quarter = 16'sd32609;
+			61: bfly_sin_quarter = 16'sd32678;
+			62: bfly_sin_quarter = 16'sd32728;
+			63: bfly_sin_quarter = 16'sd32757;
+			64: bfly_sin_quarter = 16'sd32767;
+			default: bfly_sin_quarter = 0;
+		endcase
+	end
+	endfunction
+
+	// One half of a radix-2 butterfly on packed {im, re} Q15 lanes:
+	// sat16(round((a*2^15 +/- w*b) >> (15 + scale))).
+	function [31:0] bfly_out;
+		input [31:0] a, b, w;
+		input sub, scale;
+		reg  signed [15:0] ar, ai, br, bi, wr, wi;
+		reg  signed [33:0] tr, ti, yr, yi;
+	begin
+		ar = a[15:0];
+		ai = a[31:16];
+		br = b[15:0];
+		bi = b[31:16];
+		wr = w[15:0];
+		wi = w[31:16];
+
+		tr = wr * br - wi * bi;
+		ti = wr * bi + wi * br;
+		yr = sub ? (ar <<< 15) - tr : (ar <<< 15) + tr;
+		yi = sub ? (ai <<< 15) - ti : (ai <<< 15) + ti;
+
+		if (scale) begin
+			yr = (yr + 34'sd32768) >>> 16;
+			yi = (yi + 34'sd32768) >>> 16;
+		end else begin
+			yr = (yr + 34'sd16384) >>> 15;
+			yi = (yi + 34'sd16384) >>> 15;
+		end
+
+		bfly_out = {sat16_from32(yi[31:0]), sat16_from32(yr[31:0])};
+	end
+	endfunction
+
+	// Lane-wise 16-bit add (sub = 0) or subtract (sub = 1) with 17-bit
+	// lanes {y1, y0}, before ADD16S/SUB16S saturate them.
+	function [33:0] addsub16_wide;
+		input [31:0] rs1, rs2;
+		input sub;
+		reg  signed [15:0] a0, a1, b0, b1;
+		reg  signed [16:0] y0, y1;
+	begin
+		a0 = rs1[15:0];
+		a1 = rs1[31:16];
+		b0 = rs2[15:0];
+		b1 = rs2[31:16];
+		y0 = sub ? a0 - b0 : a0 + b0;
+		y1 = sub ? a1 - b1 : a1 + b1;
+		addsub16_wide = {y1, y0};
+	end
+	endfunction
+
+	// Lane-wise Q15 multiply: sat16((a*b [+ 2^14]) >>> 15). Only
+	// -1.0 * -1.0 can saturate.
+	function [31:0] mulq15_lanes;
+		input [31:0] rs1, rs2;
+		input rnd;
 		reg  signed [15:0] a0, a1, b0, b1;
 		reg  signed [31:0] p0, p1;
 	begin
@@ -2620,9 +3605,218 @@ module picorv32_pcpi_audio (
 		a1 = rs1[31:16];
 		b0 = rs2[15:0];
 		b1 = rs2[31:16];
-		p0 = a0 * b0;
-		p1 = a1 * b1;
-		msub16 = p0 - p1;
+		p0 = (a0 * b0 + (rnd ? 32'sd16384 : 32'sd0)) >>> 15;
+		p1 = (a1 * b1 + (rnd ? 32'sd16384 : 32'sd0)) >>> 15;
+		mulq15_lanes = {sat16_from32(p1), sat16_from32(p0)};
+	end
+	endfunction
+
+	// Q15 linear interpolation a + frac*(b - a), rounded half up, before
+	// LERP16 saturates it. frac is unsigned, so values above 1.0 (0x8000)
+	// extrapolate.
+	function signed [31:0] lerp16_wide;
+		input [15:0] a, b, frac;
+		reg signed [16:0] d;
+		reg signed [33:0] p;
+	begin
+		d = $signed(b) - $signed(a);
+		p = d * $signed({1'b0, frac});
+		lerp16_wide = $signed(a) + ((p + 34'sd16384) >>> 15);
+	end
+	endfunction
+
+	// Median of the newest three (five = 0) or all five signed 16-bit
+	// samples in w. Each sample is ranked against the others, ties broken
+	// by position, and the middle rank is selected: a single level of
+	// comparators instead of a sorting network.
+	function [15:0] median16;
+		input [79:0] w;
+		input five;
+		integer a, b, n, r;
+	begin
+		n = five ? 5 : 3;
+		median16 = 0;
+		for (a = 0; a < 5; a = a+1) begin
+			r = 0;
+			for (b = 0; b < 5; b = b+1)
+				if (b != a && b < n && ($signed(w[16*b +: 16]) < $signed(w[16*a +: 16]) ||
+						w[16*b +: 16] == w[16*a +: 16] && b < a))
+					r = r + 1;
+			if (a < n && r == n / 2)
+				median16 = w[16*a +: 16];
+		end
+	end
+	endfunction
+
+	// round(2^20 / pi * atan(2^-i)), i = 0..19 (CORDIC angles, pi = 2^20)
+	function signed [22:0] cordic_atan;
+		input [4:0] i;
+	begin
+		case (i)
+			 0: cordic_atan = 23'sd262144;
+			 1: cordic_atan = 23'sd154753;
+			 2: cordic_atan = 23'sd81767;
+			 3: cordic_atan = 23'sd41506;
+			 4: cordic_atan = 23'sd20834;
+			 5: cordic_atan = 23'sd10427;
+			 6: cordic_atan = 23'sd5215;
+			 7: cordic_atan = 23'sd2608;
+			 8: cordic_atan = 23'sd1304;
+			 9: cordic_atan = 23'sd652;
+			10: cordic_atan = 23'sd326;
+			11: cordic_atan = 23'sd163;
+			12: cordic_atan = 23'sd81;
+			13: cordic_atan = 23'sd41;
+			14: cordic_atan = 23'sd20;
+			15: cordic_atan = 23'sd10;
+			16: cordic_atan = 23'sd5;
+			17: cordic_atan = 23'sd3;
+			18: cordic_atan = 23'sd1;
+			19: cordic_atan = 23'sd1;
+			default: cordic_atan = 0;
+		endcase
+	end
+	endfunction
+
+	// round(65536 * log2(1 + i/16)), i = 0..16
+	function [16:0] log2_tab;
+		input [4:0] i;
+	begin
+		case (i)
+			 0: log2_tab = 17'd0;
+			 1: log2_tab = 17'd5732;
+			 2: log2_tab = 17'd11136;
+			 3: log2_tab = 17'd16248;
+			 4: log2_tab = 17'd21098;
+			 5: log2_tab = 17'd25711;
+			 6: log2_tab = 17'd30109;
+			 7: log2_tab = 17'd34312;
+			 8: log2_tab = 17'd38336;
+			 9: log2_tab = 17'd42196;
+			10: log2_tab = 17'd45904;
+			11: log2_tab = 17'd49472;
+			12: log2_tab = 17'd52911;
+			13: log2_tab = 17'd56229;
+			14: log2_tab = 17'd59434;
+			15: log2_tab = 17'd62534;
+			16: log2_tab = 17'd65536;
+			default: log2_tab = 0;
+		endcase
+	end
+	endfunction
+
+	// round(65536 * 2^(i/16)), i = 0..16
+	function [17:0] exp2_tab;
+		input [4:0] i;
+	begin
+		case (i)
+			 0: exp2_tab = 18'd65536;
+			 1: exp2_tab = 18'd68438;
+			 2: exp2_tab = 18'd71468;
+			 3: exp2_tab = 18'd74632;
+			 4: exp2_tab = 18'd77936;
+			 5: exp2_tab = 18'd81386;
+			 6: exp2_tab = 18'd84990;
+			 7: exp2_tab = 18'd88752;
+			 8: exp2_tab = 18'd92682;
+			 9: exp2_tab = 18'd96785;
+			10: exp2_tab = 18'd101070;
+			11: exp2_tab = 18'd105545;
+			12: exp2_tab = 18'd110218;
+			13: exp2_tab = 18'd115098;
+			14: exp2_tab = 18'd120194;
+			15: exp2_tab = 18'd125515;
+			16: exp2_tab = 18'd131072;
+			default: exp2_tab = 0;
+		endcase
+	end
+	endfunction
+
+	// log2(x) in Q8.8 for unsigned x: the leading-one position is the
+	// integer part, the next 4 mantissa bits index log2_tab and the 12
+	// after them interpolate linearly. Error < 0.7 LSB; log2(0) returns
+	// -128.0 (0x8000), sign-extended.
+	function [31:0] log2q;
+		input [31:0] x;
+		reg [4:0]  e;
+		reg [31:0] m;
+		reg [16:0] t0, t1;
+		reg [28:0] v;
+		reg [13:0] y;
+		integer k;
+	begin
+		e = 0;
+		for (k = 0; k < 32; k = k+1)
+			if (x[k]) e = k;
+		m = x << (31 - e);
+		t0 = log2_tab(m[30:27]);
+		t1 = log2_tab(m[30:27] + 1);
+		v = ((t1 - t0) * m[26:15]) >> 12;
+		v = v + t0 + 128;
+		y = {e, 8'd0} + v[16:8];
+		log2q = x ? {18'd0, y} : 32'hffff8000;
+	end
+	endfunction
+
+	// 2^y for y = rs1[15:0] in signed Q8.8, rounded to an unsigned
+	// integer and saturated to 0xffffffff: the inverse of log2q. The
+	// fraction is interpolated from exp2_tab (relative error < 2.5e-4)
+	// before the final rounding shift.
+	function [31:0] exp2q;
+		input [15:0] y;
+		reg signed [7:0] n;
+		reg [17:0] e0, e1;
+		reg [17:0] m;
+		reg [47:0] r;
+	begin
+		n = y[15:8];
+		e0 = exp2_tab(y[7:4]);
+		e1 = exp2_tab(y[7:4] + 1);
+		m = e0 + (((e1 - e0) * y[3:0]) >> 4);
+		if (n > 31)
+			exp2q = 32'hffffffff;
+		else if (n >= 16) begin
+			r = m << (n - 16);
+			exp2q = r[47:32] ? 32'hffffffff : r[31:0];
+		end else if (n >= -2) begin
+			r = (m + (48'd1 << (15 - n))) >> (16 - n);
+			exp2q = r[31:0];
+		end else
+			exp2q = 0;
+	end
+	endfunction
+
+	// 2x16-bit MSUB: (a0*b0 - a1*b1)
+	function [31:0] msub16;
+		input [31:0] rs1, rs2;
+		reg  signed [32:0] y;
+	begin
+		y = mac16_wide(rs1, rs2, 1);
+		msub16 = y[31:0];
+	end
+	endfunction
+
+	// Lane-wise signed minimum (max = 0) or maximum (max = 1).
+	function [31:0] minmax16_lanes;
+		input [31:0] rs1, rs2;
+		input max;
+		reg signed [15:0] a0, a1, b0, b1;
+	begin
+		a0 = rs1[15:0];
+		a1 = rs1[31:16];
+		b0 = rs2[15:0];
+		b1 = rs2[31:16];
+		minmax16_lanes[15:0]  = (a0 > b0) == max ? a0 : b0;
+		minmax16_lanes[31:16] = (a1 > b1) == max ? a1 : b1;
+	end
+	endfunction
+
+	// Lane-wise unsigned maximum (for magnitudes from abs16_lanes).
+	function [31:0] umax16_lanes;
+		input [31:0] x, y;
+	begin
+		umax16_lanes[15:0]  = x[15:0]  > y[15:0]  ? x[15:0]  : y[15:0];
+		umax16_lanes[31:16] = x[31:16] > y[31:16] ? x[31:16] : y[31:16];
 	end
 	endfunction
 
@@ -2681,15 +3875,15 @@ module picorv32_pcpi_audio (
 	end
 	endfunction
 
-	// Complex 16-bit multiply with 16-bit saturated outputs.
-	// rs1 = ar + j*ai, rs2 = br + j*bi (ar,ai,br,bi are signed 16-bit).
+	// Complex 16-bit multiply, full width: {imag, real} as two signed
+	// 32-bit parts. rs1 = ar + j*ai, rs2 = br + j*bi (ar,ai,br,bi are
+	// signed 16-bit). CMAC saturates each part to 16 bits:
 	// rd[15:0]  = real part
 	// rd[31:16] = imag part
-	function [31:0] cmac_complex;
+	function [63:0] cmac_wide;
 		input [31:0] rs1, rs2;
 		reg  signed [15:0] ar, ai, br, bi;
 		reg  signed [31:0] realp, imagp;
-		reg        [15:0] real16, imag16;
 	begin
 		ar = rs1[15:0];
 		ai = rs1[31:16];
@@ -2699,10 +3893,7 @@ module picorv32_pcpi_audio (
 		realp = ar * br - ai * bi;
 		imagp = ar * bi + ai * br;
 
-		real16 = sat16_from32(realp);
-		imag16 = sat16_from32(imagp);
-
-		cmac_complex = {imag16, real16};
+		cmac_wide = {imagp, realp};
 	end
 	endfunction
 
@@ -2750,98 +3941,735 @@ module picorv32_pcpi_audio (
 	end
 	endfunction
 
-	// Signed fixed-point scaling shift with rounding.
-	// Shift amount = rs2[4:0]. Positive arithmetic right shift with
-	// "round to nearest" semantics.
-	function [31:0] shiftn_round;
+	// Saturation detectors for the status flags. The range checks take
+	// the same wide value the op saturates; the others only look at the
+	// operands.
+	function sat16_ovf;
+		input signed [31:0] x;
+	begin
+		sat16_ovf = x > 32'sd32767 || x < -32'sd32768;
+	end
+	endfunction
+
+	function sat41_ovf;
+		input signed [40:0] x;
+		input narrow;
+	begin
+		if (narrow)
+			sat41_ovf = x > 41'sd32767 || x < -41'sd32768;
+		else
+			sat41_ovf = x > 41'sd2147483647 || x < -41'sd2147483648;
+	end
+	endfunction
+
+	function abs16_ovf;
+		input [31:0] x;
+	begin
+		abs16_ovf = x[15:0] == 16'h8000 || x[31:16] == 16'h8000;
+	end
+	endfunction
+
+	// Only -1.0 * -1.0 saturates, with or without rounding.
+	function mulq15_ovf;
 		input [31:0] rs1, rs2;
-		reg  signed [31:0] x;
-		reg  signed [31:0] abs_val;
-		reg  signed [31:0] res;
-		reg  [4:0] shamt;
-		reg  [31:0] bias;
 	begin
-		x = rs1;
-		shamt = rs2[4:0];
+		mulq15_ovf = rs1[15:0] == 16'h8000 && rs2[15:0] == 16'h8000 ||
+				rs1[31:16] == 16'h8000 && rs2[31:16] == 16'h8000;
+	end
+	endfunction
+
+	// Signed fixed-point scaling shift with rounding: x >>> shamt, then
+	// the discarded bits decide the increment. Half away from zero and
+	// half to even differ only on an exact tie; TRUNC rounds down.
+	function [63:0] shiftn_round;
+		input signed [63:0] x;
+		input [5:0] shamt;
+		input [1:0] mode;
+		reg  signed [63:0] q;
+		reg  [63:0] rem, half;
+		reg  up;
+	begin
 		if (shamt == 0) begin
 			shiftn_round = x;
 		end else begin
-			bias = 32'd1 << (shamt - 1);
-			if (x >= 0) begin
-				res = (x + bias) >>> shamt;
-			end else begin
-				abs_val = -x;
-				res = -((abs_val + bias) >>> shamt);
-			end
-			shiftn_round = res;
+			q = x >>> shamt;
+			rem = x & ((64'd1 << shamt) - 1);
+			half = 64'd1 << (shamt - 1);
+			case (mode)
+				SHN_TRUNC: up = 0;
+				SHN_EVEN:  up = rem > half || rem == half && q[0];
+				default:   up = rem > half || rem == half && !x[63];
+			endcase
+			shiftn_round = q + up;
 		end
 	end
 	endfunction
 
-		always @* begin
+	// Helper: saturate a signed 64-bit value to signed 32-bit, or to
+	// signed 16-bit (sign-extended) when narrow is set.
+	function [31:0] sat_from64;
+		input signed [63:0] x;
+		input narrow;
+	begin
+		if (narrow) begin
+			if (x > 64'sd32767)
+				sat_from64 = 32'sd32767;
+			else if (x < -64'sd32768)
+				sat_from64 = -32'sd32768;
+			else
+				sat_from64 = x[31:0];
+		end else begin
+			if (x > 64'sd2147483647)
+				sat_from64 = 32'h7fffffff;
+			else if (x < -64'sd2147483648)
+				sat_from64 = 32'h80000000;
+			else
+				sat_from64 = x[31:0];
+		end
+	end
+	endfunction
+
+	function sat64_ovf;
+		input signed [63:0] x;
+		input narrow;
+	begin
+		if (narrow)
+			sat64_ovf = x > 64'sd32767 || x < -64'sd32768;
+		else
+			sat64_ovf = x > 64'sd2147483647 || x < -64'sd2147483648;
+	end
+	endfunction
+
+	always @* begin
 		result = 0;
 		result_valid = 0;
+		result_wr = 1;
+		result_sat = 0;
 
-			if (resetn && pcpi_valid && is_custom0) begin
+			if (exec_valid) begin
 				case (funct7)
-					7'b0100000: begin
+					7'b0100000: if (HAS_MAC16 && !SHARED_MUL) begin
 						// MAC16
-						result = mac16(pcpi_rs1, pcpi_rs2);
+						result = mac16(exec_rs1, exec_rs2);
 						result_valid = 1;
 					end
-					7'b0100001: begin
+					7'b0100001: if (HAS_MSUB16 && !SHARED_MUL) begin
 						// MSUB16
-						result = msub16(pcpi_rs1, pcpi_rs2);
+						result = msub16(exec_rs1, exec_rs2);
 						result_valid = 1;
 					end
-					7'b0100010: begin
+					7'b0100010: if (HAS_ABS16) begin
 						// ABS16
-						result = abs16_lanes(pcpi_rs1);
+						result = abs16_lanes(exec_rs1);
+						result_sat = abs16_ovf(exec_rs1);
 						result_valid = 1;
 					end
-					7'b0100011: begin
+					7'b0100011: if (HAS_CONV4) begin
 						// CONV4
-						result = conv4_8bit(pcpi_rs1, pcpi_rs2);
+						result = conv4_8bit(exec_rs1, exec_rs2);
 						result_valid = 1;
 					end
-					7'b0100100: begin
-						// CONV8 (currently same as CONV4)
-						result = conv4_8bit(pcpi_rs1, pcpi_rs2);
+					7'b0100100: if (HAS_CONV8) begin
+						// CONV8
+						case (funct3)
+							CONV8_SETH: result = conv8_coef;
+							CONV8_CLR:  result = 0;
+							default:    result = conv4_8bit(conv8_next[31:0], exec_rs2) +
+									conv4_8bit(conv8_next[63:32], conv8_coef);
+						endcase
 						result_valid = 1;
 					end
-					7'b0100101: begin
-						// LMSSTEP (currently same as MAC16)
-						result = mac16(pcpi_rs1, pcpi_rs2);
-						result_valid = 1;
+					7'b0100101: if (HAS_LMS) begin
+						// LMSSTEP: STEP completes through lms_done
+						case (funct3)
+							LMS_SETC, LMS_GETC: begin
+								result = lms_idx_ok ? {{16{lms_c[lms_idx][15]}}, lms_c[lms_idx]} : 0;
+								result_valid = 1;
+							end
+							LMS_CFG: begin
+								result = LMS_N;
+								result_valid = 1;
+							end
+							LMS_CLR: begin
+								result = 0;
+								result_valid = 1;
+							end
+						endcase
 					end
-					7'b0100110: begin
+					7'b0100110: if (HAS_CMAC) begin
 						// CMAC
-						result = cmac_complex(pcpi_rs1, pcpi_rs2);
+						result = {sat16_from32(cmac_y[63:32]), sat16_from32(cmac_y[31:0])};
+						result_sat = sat16_ovf(cmac_y[63:32]) || sat16_ovf(cmac_y[31:0]);
 						result_valid = 1;
 					end
-					7'b0100111: begin
+					7'b0100111: if (HAS_ABS2) begin
 						// ABS2
-						result = abs2_complex(pcpi_rs1);
+						result = abs2_complex(exec_rs1);
 						result_valid = 1;
 					end
-					7'b0101000: begin
+					7'b0101000: if (HAS_CLIP16) begin
 						// CLIP16
-						result = clip16_lanes(pcpi_rs1, pcpi_rs2);
+						// counts as saturating whenever a lane was clipped
+						result = clip_y;
+						result_sat = clip_y != exec_rs1;
+						result_valid = 1;
+					end
+					7'b0101001: if (HAS_SHIFTN) begin
+						// SHIFTN/SHIFTN64, funct3[1:0] = rounding mode
+						if (shn_wide) begin
+							result = sat_from64(shn_q, shn_narrow);
+							result_sat = sat64_ovf(shn_q, shn_narrow);
+						end else
+							result = shn_q[31:0];
+						result_valid = 1;
+					end
+					7'b0101010: if (HAS_MACA) begin
+						// MACA: accumulate only, rd is not written
+						result_valid = 1;
+						result_wr = 0;
+					end
+					7'b0101011: if (HAS_ACCRD) begin
+						// ACCRD
+						result = sat_from41(acc_scaled, funct3[2]);
+						result_sat = sat41_ovf(acc_scaled, funct3[2]);
+						result_valid = 1;
+					end
+					7'b0101100: if (HAS_ACCCLR) begin
+						// ACCCLR/ACCSET: rd is not written
+						result_valid = 1;
+						result_wr = 0;
+					end
+					7'b0101101: if (HAS_BIQUAD) begin
+						// BIQUAD
+						case (funct3)
+							BQ_STEP: result = {{16{bq_y[15]}}, bq_y};
+							BQ_SETC: result = {{16{bq_coef[15]}}, bq_coef};
+							BQ_CLR:  result = 0;
+						endcase
+						result_sat = funct3 == BQ_STEP && (sat16_ovf(bq_yw[31:0]) ||
+								sat41_ovf(bq_s1_next, 0) || sat41_ovf(bq_s2_next, 0));
+						result_valid = 1;
+					end
+					7'b0101110: if (HAS_BFLY) begin
+						// BFLY
+						case (funct3)
+							BFLY_TW:   result = bfly_w;
+							BFLY_TWK:  result = bfly_rom_w;
+							BFLY_DIFF: result = bfly_diff;
+							default:   result = bfly_sum;
+						endcase
+						result_valid = 1;
+					end
+					7'b0101111: if (HAS_LANE16) begin
+						// LANE16
+						case (funct3)
+							L16_ADD16S, L16_SUB16S: result = {sat16_from32(addsub_y1), sat16_from32(addsub_y0)};
+							L16_PKLO:   result = {exec_rs2[15:0], exec_rs1[15:0]};
+							L16_PKHI:   result = {exec_rs2[31:16], exec_rs1[31:16]};
+							L16_SXTLO:  result = {{16{exec_rs1[15]}}, exec_rs1[15:0]};
+							L16_SXTHI:  result = {{16{exec_rs1[31]}}, exec_rs1[31:16]};
+						endcase
+						result_sat = funct3 <= L16_SUB16S && (sat16_ovf(addsub_y0) || sat16_ovf(addsub_y1));
+						result_valid = 1;
+					end
+					7'b0110001: if (HAS_NORM) begin
+						// NORM: completes through nrm_done
+					end
+					7'b0110010: if (HAS_LOG2Q) begin
+						// LOG2Q/EXP2Q
+						result = funct3 == LOG2_EXP ? exp2q(exec_rs1[15:0]) : log2q(exec_rs1);
+						result_valid = 1;
+					end
+					7'b0110011: if (HAS_CIRC) begin
+						// CIRC
+						case (funct3)
+							CIRC_NEXT: result = circ_cur_addr;
+							CIRC_SETB: result = circ_base[circ_p];
+							CIRC_ADDR: result = circ_off_addr;
+							default:   result = circ_idx[circ_p];
+						endcase
+						result_valid = 1;
+					end
+					7'b0110000: if (HAS_MULQ15) begin
+						// MULQ15/MULQ15R
+						result = mulq15_lanes(exec_rs1, exec_rs2, funct3 == MULQ15_RND);
+						result_sat = mulq15_ovf(exec_rs1, exec_rs2);
+						result_valid = 1;
+					end
+					7'b0110100, 7'b0110101: if ((funct7[0] ? HAS_MSUBC16 : HAS_MACC16) && !SHARED_MUL) begin
+						// MACC16/MSUBC16
+						result = sat_from41(macc_sum, 0);
+						result_sat = sat41_ovf(macc_sum, 0);
+						result_valid = 1;
+					end
+					7'b0110110: if (HAS_MINMAX) begin
+						// MIN16/MAX16/MAXABS16/PEAKHOLD
+						case (funct3)
+							MM_MIN16:    result = minmax16_lanes(exec_rs1, exec_rs2, 0);
+							MM_MAX16:    result = minmax16_lanes(exec_rs1, exec_rs2, 1);
+							MM_MAXABS16: result = umax16_lanes(pk_abs, abs16_lanes(exec_rs2));
+							MM_PEAK:     result = pk_next;
+							MM_PKCFG:    result = pk_val;
+							MM_PKCLR:    result = 0;
+						endcase
+						result_sat = funct3 == MM_MAXABS16 && (abs16_ovf(exec_rs1) || abs16_ovf(exec_rs2)) ||
+								funct3 == MM_PEAK && abs16_ovf(exec_rs1);
 						result_valid = 1;
 					end
-					7'b0101001: begin
-						// SHIFTN
-						result = shiftn_round(pcpi_rs1, pcpi_rs2);
+					7'b0110111: if (HAS_ENVF) begin
+						// ENVF
+						case (funct3)
+							ENVF_CFG, ENVF_SET: result = envf_val[envf_ch];
+							default:            result = envf_next;
+						endcase
+						result_valid = 1;
+					end
+					7'b0111000: if (HAS_CORDIC) begin
+						// CORDIC: completes through cor_done
+					end
+					7'b0111001: if (HAS_MEDIAN) begin
+						// MED3/MED5
+						if (funct3 != MED_CLR)
+							result = {{16{med_sel[15]}}, med_sel};
+						result_valid = 1;
+					end
+					7'b0111010: if (HAS_LERP16) begin
+						// LERP16: {b, a} in rs1, or a/b lanes in rs1/rs2 with frac in rd
+						if (lerp_x2) begin
+							result = {lerp_y1, lerp_y0};
+							result_sat = sat16_ovf(lerp_w1) || sat16_ovf(lerp_w0);
+						end else begin
+							result = {{16{lerp_y0[15]}}, lerp_y0};
+							result_sat = sat16_ovf(lerp_w0);
+						end
+						result_valid = 1;
+					end
+					7'b0111011: if (HAS_AREG) begin
+						// ARW/ARR and the MAC16/MACC16/MULQ15R/CONV4 forms on areg[k]
+						case (funct3)
+							AR_MAC16:  result = mac16(exec_rs1, areg_rd);
+							AR_MACC16: result = sat_from41(areg_macc, 0);
+							AR_MULQ15: result = mulq15_lanes(exec_rs1, areg_rd, 1);
+							AR_CONV4:  result = conv4_8bit(exec_rs1, areg_rd);
+							default:   result = areg_rd;
+						endcase
+						result_sat = funct3 == AR_MACC16 && sat41_ovf(areg_macc, 0) ||
+								funct3 == AR_MULQ15 && mulq15_ovf(exec_rs1, areg_rd);
 						result_valid = 1;
+					end
+					7'b0111100: if (HAS_SATST) begin
+						// SATRD/SATCLR: both return the flags before the clear
+						result = sat_flags;
+						result_valid = 1;
+					end
+			endcase
+		end
+	end
+
+	// Single-cycle ops complete in the cycle they execute, the iterative
+	// LMS, NORM and CORDIC engines and the shared multiplier sequence
+	// signal completion with lms_done/nrm_done/cor_done/smul_done.
+	wire        exec_done = result_valid || lms_done || nrm_done || cor_done || smul_done;
+	wire        exec_wr   = lms_done || nrm_done || cor_done || smul_done || result_wr;
+	wire [31:0] exec_rd   = lms_done ? lms_rd : nrm_done ? nrm_rd : cor_done ? cor_rd :
+			smul_done ? smul_rd : result;
+	wire        exec_sat  = smul_done ? smul_acc && sat41_ovf(smul_sum, 0) : result_valid && result_sat;
+
+	always @(posedge clk) begin
+		op_valid <= 0;
+		res_valid <= 0;
+
+		if (PIPELINE_STAGES >= 1 && accept) begin
+			op_valid <= 1;
+			op_insn <= pcpi_insn;
+			op_rs1 <= pcpi_rs1;
+			op_rs2 <= pcpi_rs2;
+			op_rs3 <= pcpi_rs3;
+		end
+
+		if (PIPELINE_STAGES >= 2 && exec_done) begin
+			res_valid <= 1;
+			res_wr <= exec_wr;
+			res_rd <= exec_rd;
+		end
+
+		busy <= (busy || accept) && !pcpi_ready;
+
+		if (!resetn) begin
+			busy <= 0;
+			op_valid <= 0;
+			res_valid <= 0;
+		end
+	end
+
+	always @(posedge clk) begin
+		if (HAS_CONV8 && exec_valid && funct7 == 7'b0100100) begin
+			case (funct3)
+				CONV8_WORD, CONV8_PUSH: conv8_line <= conv8_next;
+				CONV8_SETH: conv8_coef <= exec_rs1;
+				CONV8_CLR:  conv8_line <= 0;
+			endcase
+		end
+
+		if (!resetn) begin
+			conv8_line <= 0;
+			conv8_coef <= 0;
+		end
+	end
+
+	always @(posedge clk) begin
+		if (exec_valid) begin
+			case (funct7)
+				7'b0101010: if (HAS_MACA) accum[acc_sel] <= acc_sum;
+				7'b0101100: if (HAS_ACCCLR) accum[acc_sel] <= funct3[2] ? $signed(exec_rs1) : 0;
+			endcase
+		end
+
+		if (!resetn) begin
+			accum[0] <= 0;
+			accum[1] <= 0;
+			accum[2] <= 0;
+			accum[3] <= 0;
+		end
+	end
+
+	always @(posedge clk) begin
+		if (HAS_BFLY && exec_valid && funct7 == 7'b0101110) begin
+			case (funct3)
+				BFLY_TW:  bfly_w <= exec_rs1;
+				BFLY_TWK: bfly_w <= bfly_rom_w;
+				BFLY_SUM, BFLY_SCALE: bfly_diff <= bfly_diff_next;
+			endcase
+		end
+
+		if (!resetn) begin
+			bfly_w <= {16'd0, 16'd32767};
+			bfly_diff <= 0;
+		end
+	end
+
+	always @(posedge clk) begin
+		if (HAS_BIQUAD && exec_valid && funct7 == 7'b0101101) begin
+			case (funct3)
+				BQ_STEP: begin
+					bq_s1[bq_sec] <= sat_from41(bq_s1_next, 0);
+					bq_s2[bq_sec] <= sat_from41(bq_s2_next, 0);
+				end
+				BQ_SETC: begin
+					case (bq_k)
+						0: bq_b0[bq_sec] <= exec_rs2[15:0];
+						1: bq_b1[bq_sec] <= exec_rs2[15:0];
+						2: bq_b2[bq_sec] <= exec_rs2[15:0];
+						3: bq_a1[bq_sec] <= exec_rs2[15:0];
+						4: bq_a2[bq_sec] <= exec_rs2[15:0];
+					endcase
+				end
+				BQ_CLR: begin
+					for (i = 0; i < 4; i = i+1) begin
+						bq_s1[i] <= 0;
+						bq_s2[i] <= 0;
+					end
 				end
 			endcase
 		end
+
+		if (!resetn) begin
+			for (i = 0; i < 4; i = i+1) begin
+				bq_b0[i] <= 0;
+				bq_b1[i] <= 0;
+				bq_b2[i] <= 0;
+				bq_a1[i] <= 0;
+				bq_a2[i] <= 0;
+				bq_s1[i] <= 0;
+				bq_s2[i] <= 0;
+			end
+		end
+	end
+
+	always @(posedge clk) begin
+		if (HAS_CIRC && exec_valid && funct7 == 7'b0110011) begin
+			case (funct3)
+				CIRC_NEXT: circ_idx[circ_p] <= circ_wrap;
+				CIRC_SETB: begin
+					circ_base[circ_p] <= exec_rs1;
+					circ_idx[circ_p] <= 0;
+				end
+				CIRC_SETL: begin
+					circ_len[circ_p] <= exec_rs1[15:0];
+					circ_esz[circ_p] <= exec_rs1[17:16];
+					circ_idx[circ_p] <= 0;
+				end
+				CIRC_SETI: circ_idx[circ_p] <= exec_rs1[15:0] < circ_len[circ_p] ? exec_rs1[15:0] : 16'd0;
+			endcase
+		end
+
+		if (!resetn) begin
+			for (i = 0; i < 4; i = i+1) begin
+				circ_base[i] <= 0;
+				circ_len[i] <= 0;
+				circ_idx[i] <= 0;
+				circ_esz[i] <= 0;
+			end
+		end
+	end
+
+	always @(posedge clk) begin
+		if (HAS_MINMAX && exec_valid && funct7 == 7'b0110110) begin
+			case (funct3)
+				MM_PEAK:  pk_val <= pk_next;
+				MM_PKCFG: pk_decay <= exec_rs1[3:0];
+				MM_PKCLR: pk_val <= 0;
+			endcase
+		end
+
+		if (!resetn) begin
+			pk_val <= 0;
+			pk_decay <= 0;
+		end
+	end
+
+	always @(posedge clk) begin
+		if (HAS_AREG && exec_valid && funct7 == 7'b0111011 && funct3 == AR_WRITE && areg_k < AR_N)
+			areg[areg_k] <= exec_rs1;
+
+		if (!resetn) begin
+			for (i = 0; i < AR_N; i = i+1)
+				areg[i] <= 0;
+		end
+	end
+
+	// The flag index is funct7 of the completing op; exec_insn still holds
+	// it when a multi-cycle op finishes.
+	always @(posedge clk) begin
+		if (HAS_SATST && exec_done && exec_sat)
+			sat_flags[funct7[4:0]] <= 1;
+		if (HAS_SATST && exec_valid && funct7 == 7'b0111100 && funct3 == SAT_CLEAR)
+			sat_flags <= sat_flags & ~exec_rs1;
+
+		if (!resetn)
+			sat_flags <= 0;
+	end
+
+	always @(posedge clk) begin
+		if (HAS_MEDIAN && exec_valid && funct7 == 7'b0111001)
+			med_win <= funct3 == MED_CLR ? 80'd0 : med_next;
+
+		if (!resetn)
+			med_win <= 0;
+	end
+
+	always @(posedge clk) begin
+		if (HAS_ENVF && exec_valid && funct7 == 7'b0110111) begin
+			case (funct3)
+				ENVF_LVL, ENVF_ABS, ENVF_SQ: envf_val[envf_ch] <= envf_next;
+				ENVF_CFG: begin
+					envf_att[envf_ch] <= exec_rs1[4:0];
+					envf_rel[envf_ch] <= exec_rs1[12:8];
+				end
+				ENVF_SET: envf_val[envf_ch] <= exec_rs1;
+			endcase
+		end
+
+		if (!resetn) begin
+			for (i = 0; i < 4; i = i+1) begin
+				envf_val[i] <= 0;
+				envf_att[i] <= 0;
+				envf_rel[i] <= 0;
+			end
+		end
+	end
+
+	always @(posedge clk) begin
+		case (smul_st)
+			0: if (smul_start) begin
+				smul_a1 <= exec_rs1[31:16];
+				smul_b1 <= exec_rs2[31:16];
+				smul_rs3 <= exec_rs3;
+				smul_sub <= funct7[0];
+				smul_acc <= funct7[4];
+				smul_st <= 1;
+			end
+			1: begin
+				smul_p0 <= mul_y[31:0];
+				smul_st <= 2;
+			end
+			default: smul_st <= 0;
+		endcase
+
+		if (!resetn)
+			smul_st <= 0;
+	end
+
+	always @(posedge clk) begin
+		nrm_done <= 0;
+
+		if (HAS_NORM && exec_valid && funct7 == 7'b0110001) begin
+			nrm_den <= exec_rs1;
+			nrm_rem <= 1;
+			nrm_quo <= 0;
+			nrm_cnt <= funct3 == NORM_RECIP ? 31 : 47;
+			nrm_then_sqrt <= funct3 == NORM_RSQRT;
+			nrm_div <= funct3 != NORM_SQRT;
+			nrm_sqrt <= funct3 == NORM_SQRT;
+			nrm_sq_op <= {1'b0, exec_rs1, 15'b0};
+			nrm_sq_res <= 0;
+			nrm_sq_one <= 48'd1 << 46;
+		end
+
+		if (nrm_div) begin
+			nrm_quo <= nrm_quo_next;
+			nrm_rem <= {nrm_rem_next[31:0], 1'b0};
+			nrm_cnt <= nrm_cnt - 1;
+			if (nrm_cnt == 0) begin
+				nrm_div <= 0;
+				if (nrm_then_sqrt) begin
+					nrm_sqrt <= 1;
+					nrm_sq_op <= nrm_quo_next;
+				end else begin
+					nrm_rd <= nrm_quo_next[31:0];
+					nrm_done <= 1;
+				end
+			end
+		end
+
+		if (nrm_sqrt) begin
+			if (nrm_sq_ge)
+				nrm_sq_op <= nrm_sq_op - nrm_sq_try;
+			nrm_sq_res <= nrm_sq_res_next;
+			nrm_sq_one <= nrm_sq_one >> 2;
+			if (nrm_sq_one == 1) begin
+				nrm_sqrt <= 0;
+				nrm_rd <= nrm_sq_res_next[31:0];
+				nrm_done <= 1;
+			end
+		end
+
+		if (!resetn) begin
+			nrm_div <= 0;
+			nrm_sqrt <= 0;
+			nrm_done <= 0;
+		end
+	end
+
+	always @(posedge clk) begin
+		cor_fin <= 0;
+		cor_done <= 0;
+
+		if (HAS_CORDIC && exec_valid && funct7 == 7'b0111000) begin
+			cor_op <= funct3;
+			cor_i <= 0;
+			cor_run <= 1;
+			if (funct3 == COR_SINCOS) begin
+				cor_x <= cor_phase > COR_PI_2 || cor_phase < -COR_PI_2 ? -COR_INVK : COR_INVK;
+				cor_y <= 0;
+				cor_z <= cor_phase > COR_PI_2 ? cor_phase - COR_PI :
+						cor_phase < -COR_PI_2 ? cor_phase + COR_PI : cor_phase;
+			end else begin
+				cor_x <= cor_re[25] ? -cor_re : cor_re;
+				cor_y <= cor_re[25] ? -cor_im : cor_im;
+				cor_z <= !cor_re[25] ? 23'sd0 : cor_im[25] ? -COR_PI : COR_PI;
+			end
+		end
+
+		if (cor_run) begin
+			cor_x <= cor_ccw ? cor_x - cor_ys : cor_x + cor_ys;
+			cor_y <= cor_ccw ? cor_y + cor_xs : cor_y - cor_xs;
+			cor_z <= cor_ccw ? cor_z - cor_a : cor_z + cor_a;
+			cor_i <= cor_i + 1;
+			if (cor_i == COR_N - 1) begin
+				cor_run <= 0;
+				cor_fin <= 1;
+			end
+		end
+
+		if (cor_fin) begin
+			case (cor_op)
+				COR_SINCOS: cor_rd <= {sat16_from32(cor_y_q15), sat16_from32(cor_x_q15)};
+				COR_ATAN2:  cor_rd <= {{16{cor_z_q15[15]}}, cor_z_q15[15:0]};
+				default:    cor_rd <= cor_mag >> (16 + COR_G);
+			endcase
+			cor_done <= 1;
+		end
+
+		if (!resetn) begin
+			cor_run <= 0;
+			cor_fin <= 0;
+			cor_done <= 0;
+		end
+	end
+
+	always @(posedge clk) begin
+		lms_fin <= 0;
+		lms_done <= 0;
+
+		if (HAS_LMS && exec_valid && funct7 == 7'b0100101) begin
+			case (funct3)
+				LMS_STEP: begin
+					for (i = LMS_N; i > 0; i = i-1)
+						lms_x[i] <= lms_x[i-1];
+					lms_x[0] <= exec_rs1[15:0];
+					lms_d <= exec_rs2[15:0];
+					lms_acc <= 0;
+					lms_k <= 0;
+					lms_run <= 1;
+				end
+				LMS_SETC: begin
+					if (lms_idx_ok)
+						lms_c[lms_idx] <= exec_rs2[15:0];
+				end
+				LMS_CFG: begin
+					lms_mu <= exec_rs1[15:0];
+					lms_shift <= exec_rs2[4:0];
+					lms_len <= exec_rs2[14:8] && exec_rs2[14:8] <= LMS_N ? exec_rs2[14:8] : LMS_N;
+				end
+				LMS_CLR: begin
+					for (i = 0; i <= LMS_N; i = i+1)
+						lms_x[i] <= 0;
+					for (i = 0; i < LMS_N; i = i+1)
+						lms_c[i] <= 0;
+					lms_g <= 0;
+				end
+			endcase
+		end
+
+		if (lms_run) begin
+			lms_acc <= lms_acc + lms_prod;
+			lms_c[lms_k] <= sat16_from32(lms_c[lms_k] + lms_delta);
+			lms_k <= lms_k + 1;
+			if (lms_k == lms_len - 1) begin
+				lms_run <= 0;
+				lms_fin <= 1;
+			end
+		end
+
+		if (lms_fin) begin
+			lms_rd <= {lms_e, lms_y};
+			lms_done <= 1;
+		end
+
+		if (lms_done)
+			lms_g <= lms_g_next;
+
+		if (!resetn) begin
+			for (i = 0; i <= LMS_N; i = i+1)
+				lms_x[i] <= 0;
+			for (i = 0; i < LMS_N; i = i+1)
+				lms_c[i] <= 0;
+			lms_mu <= 0;
+			lms_g <= 0;
+			lms_shift <= 15;
+			lms_len <= LMS_N;
+			lms_run <= 0;
+			lms_fin <= 0;
+			lms_done <= 0;
+		end
 	end
 
-	assign pcpi_rd    = result;
-	assign pcpi_wr    = result_valid;
-	assign pcpi_wait  = 0;
-	assign pcpi_ready = result_valid;
+	assign pcpi_ready = PIPELINE_STAGES >= 2 ? res_valid : exec_done && !fast_accept;
+	assign fast_ready = fast_accept && exec_done;
+	assign pcpi_rd    = PIPELINE_STAGES >= 2 ? res_rd : exec_rd;
+	assign pcpi_wr    = PIPELINE_STAGES >= 2 ? res_wr : exec_wr;
+	assign pcpi_wait  = pcpi_insn_valid && !pcpi_ready;
 endmodule
 
 
@@ -2866,6 +4694,15 @@ module picorv32_axi #(
 	parameter [ 0:0] ENABLE_FAST_MUL = 0,
 	parameter [ 0:0] ENABLE_DIV = 0,
 	parameter [ 0:0] ENABLE_AUDIO = 0,
+	parameter [ 1:0] AUDIO_PIPELINE_STAGES = 0,
+	parameter [ 6:0] AUDIO_LMS_TAPS = 16,
+	parameter [ 4:0] AUDIO_CORDIC_ITERS = 16,
+	parameter [ 4:0] AUDIO_AREGS = 16,
+	parameter [31:0] AUDIO_OPS = 32'hffff_ffff,
+	parameter [ 0:0] AUDIO_SHARED_MUL = 0,
+	parameter [ 0:0] AUDIO_FAST_DECODE = 0,
+	parameter [ 0:0] ENABLE_HWLOOP = 0,
+	parameter [ 0:0] ENABLE_POSTINC = 0,
 	parameter [ 0:0] ENABLE_IRQ = 0,
 	parameter [ 0:0] ENABLE_IRQ_QREGS = 1,
 	parameter [ 0:0] ENABLE_IRQ_TIMER = 1,
@@ -2998,6 +4835,15 @@ module picorv32_axi #(
 		.ENABLE_FAST_MUL     (ENABLE_FAST_MUL     ),
 		.ENABLE_DIV          (ENABLE_DIV          ),
 		.ENABLE_AUDIO        (ENABLE_AUDIO        ),
+		.AUDIO_PIPELINE_STAGES(AUDIO_PIPELINE_STAGES),
+		.AUDIO_LMS_TAPS      (AUDIO_LMS_TAPS      ),
+		.AUDIO_CORDIC_ITERS  (AUDIO_CORDIC_ITERS  ),
+		.AUDIO_AREGS         (AUDIO_AREGS         ),
+		.AUDIO_OPS           (AUDIO_OPS           ),
+		.AUDIO_SHARED_MUL    (AUDIO_SHARED_MUL    ),
+		.AUDIO_FAST_DECODE   (AUDIO_FAST_DECODE   ),
+		.ENABLE_HWLOOP       (ENABLE_HWLOOP       ),
+		.ENABLE_POSTINC      (ENABLE_POSTINC      ),
 		.ENABLE_IRQ          (ENABLE_IRQ          ),
 		.ENABLE_IRQ_QREGS    (ENABLE_IRQ_QREGS    ),
 		.ENABLE_IRQ_TIMER    (ENABLE_IRQ_TIMER    ),
@@ -3166,6 +5012,15 @@ module picorv32_wb #(
 	parameter [ 0:0] ENABLE_FAST_MUL = 0,
 	parameter [ 0:0] ENABLE_DIV = 0,
 	parameter [ 0:0] ENABLE_AUDIO = 0,
+	parameter [ 1:0] AUDIO_PIPELINE_STAGES = 0,
+	parameter [ 6:0] AUDIO_LMS_TAPS = 16,
+	parameter [ 4:0] AUDIO_CORDIC_ITERS = 16,
+	parameter [ 4:0] AUDIO_AREGS = 16,
+	parameter [31:0] AUDIO_OPS = 32'hffff_ffff,
+	parameter [ 0:0] AUDIO_SHARED_MUL = 0,
+	parameter [ 0:0] AUDIO_FAST_DECODE = 0,
+	parameter [ 0:0] ENABLE_HWLOOP = 0,
+	parameter [ 0:0] ENABLE_POSTINC = 0,
 	parameter [ 0:0] ENABLE_IRQ = 0,
 	parameter [ 0:0] ENABLE_IRQ_QREGS = 1,
 	parameter [ 0:0] ENABLE_IRQ_TIMER = 1,
@@ -3264,6 +5119,15 @@ module picorv32_wb #(
 		.ENABLE_FAST_MUL     (ENABLE_FAST_MUL     ),
 		.ENABLE_DIV          (ENABLE_DIV          ),
 		.ENABLE_AUDIO        (ENABLE_AUDIO        ),
+		.AUDIO_PIPELINE_STAGES(AUDIO_PIPELINE_STAGES),
+		.AUDIO_LMS_TAPS      (AUDIO_LMS_TAPS      ),
+		.AUDIO_CORDIC_ITERS  (AUDIO_CORDIC_ITERS  ),
+		.AUDIO_AREGS         (AUDIO_AREGS         ),
+		.AUDIO_OPS           (AUDIO_OPS           ),
+		.AUDIO_SHARED_MUL    (AUDIO_SHARED_MUL    ),
+		.AUDIO_FAST_DECODE   (AUDIO_FAST_DECODE   ),
+		.ENABLE_HWLOOP       (ENABLE_HWLOOP       ),
+		.ENABLE_POSTINC      (ENABLE_POSTINC      ),
 		.ENABLE_IRQ          (ENABLE_IRQ          ),
 		.ENABLE_IRQ_QREGS    (ENABLE_IRQ_QREGS    ),
 		.ENABLE_IRQ_TIMER    (ENABLE_IRQ_TIMER    ),
@@ -1,6 +1,11 @@
 `timescale 1 ns / 1 ps
 
-module top (
+module top #(
+	parameter [0:0] ENABLE_FAST_MUL = 0,
+	parameter [0:0] ENABLE_AUDIO = 0,
+	parameter [31:0] AUDIO_OPS = 32'hffff_ffff,
+	parameter [0:0] AUDIO_SHARED_MUL = 0
+) (
 	input clk,
 	output reg LED0, LED1, LED2, LED3, LED4, LED5, LED6, LED7
 );
@@ -33,7 +38,11 @@ module top (
 		.TWO_STAGE_SHIFT(0),
 		.TWO_CYCLE_ALU(1),
 		.CATCH_MISALIGN(0),
-		.CATCH_ILLINSN(0)
+		.CATCH_ILLINSN(0),
+		.ENABLE_FAST_MUL(ENABLE_FAST_MUL),
+		.ENABLE_AUDIO(ENABLE_AUDIO),
+		.AUDIO_OPS(AUDIO_OPS),
+		.AUDIO_SHARED_MUL(AUDIO_SHARED_MUL)
 	) cpu (
 		.clk      (clk      ),
 		.resetn   (resetn   ),
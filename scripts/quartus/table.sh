@@ -1,8 +1,8 @@
 #!/bin/bash
 
 dashes="----------------------------------------------------------------"
-printf '| %-25s | %-10s | %-20s |\n' "Device" "Speedgrade" "Clock Period (Freq.)"
-printf '|:%.25s |:%.10s:| %.20s:|\n' $dashes $dashes $dashes
+printf '| %-25s | %-10s | %-20s | %-18s | %-10s | %-15s |\n' "Device" "Speedgrade" "Clock Period (Freq.)" "Configuration" "Logic" "Multipliers/DSP"
+printf '|:%.25s |:%.10s:| %.20s:|:%.18s |%.10s:|%.15s:|\n' $dashes $dashes $dashes $dashes $dashes $dashes
 
 for x in $( grep -H . tab_*/results.txt )
 do
@@ -12,6 +12,17 @@ do
 		ep4cgx) d="Altera Cyclone IV GX" ;;
 		5cgx)   d="Altera Cyclone V GX" ;;
 	esac
+	case "$size" in
+		small)    c="small, no audio" ;;
+		audio)    c="audio, all ops" ;;
+		audiomac) c="audio, MAC ops" ;;
+		audiofir) c="audio, FIR ops" ;;
+		audiofft) c="audio, FFT ops" ;;
+		*)        c="$size" ;;
+	esac
+	log=tab_${size}_${device}_${grade}/test_${speed}.fit.txt
+	area=$( grep -m1 -E 'Total logic elements|Logic utilization' $log | sed 's/.*: *//; s/ *\/.*//' )
+	dsps=$( grep -m1 -E 'Embedded Multiplier 9-bit elements|Total DSP Blocks' $log | sed 's/.*: *//; s/ *\/.*//' )
 	speedtxt=$( printf '%s.%s ns (%d MHz)' ${speed%?} ${speed#?} $((10000 / speed)) )
-	printf '| %-25s | %-10s | %20s |\n' "$d" "-$grade" "$speedtxt"
+	printf '| %-25s | %-10s | %20s | %-18s | %10s | %15s |\n' "$d" "-$grade" "$speedtxt" "$c" "$area" "$dsps"
 done
@@ -3,6 +3,17 @@
 set -e
 read _ ip dev grade _ < <( echo $* | tr '_/' ' '; )
 
+# The first part of tab_<ip>_<dev>_<grade> selects the core configuration:
+# "small" is the plain core, "audio*" add the audio unit with a subset of
+# AUX ops (AUDIO_OPS bit n enables funct7 0x20 + n).
+case "${ip}" in
+	audio)    audio=1; audio_ops=ffffffff ;;  # all ops
+	audiomac) audio=1; audio_ops=00301c03 ;;  # MAC16 MSUB16 MACA ACCRD ACCCLR MACC16 MSUBC16
+	audiofir) audio=1; audio_ops=00083f18 ;;  # CONV4 CONV8 CLIP16 SHIFTN MACA ACCRD ACCCLR BIQUAD CIRC
+	audiofft) audio=1; audio_ops=0001c0c0 ;;  # CMAC ABS2 BFLY LANE16 MULQ15
+	*)        audio=0; audio_ops=ffffffff ;;
+esac
+
 # rm -rf tab_${ip}_${dev}_${grade}
 mkdir -p tab_${ip}_${dev}_${grade}
 cd tab_${ip}_${dev}_${grade}
@@ -30,6 +41,8 @@ set_global_assignment -name TOP_LEVEL_ENTITY top
 set_global_assignment -name VERILOG_FILE ../tabtest.v
 set_global_assignment -name VERILOG_FILE ../../../picorv32.v
 set_global_assignment -name SDC_FILE test_${1}.sdc
+set_parameter -name ENABLE_AUDIO ${audio}
+set_parameter -name AUDIO_OPS "32'h${audio_ops}"
 	EOT
 
 	cat > test_${1}.sdc <<- EOT
@@ -49,6 +62,7 @@ set_global_assignment -name SDC_FILE test_${1}.sdc
     fi
 
 	cp output_files/test_${1}.sta.summary test_${1}.txt
+	cp output_files/test_${1}.fit.summary test_${1}.fit.txt
 }
 
 countdown=7
@@ -51,7 +51,10 @@ module testbench(input clk, mem_ready_0, mem_ready_1);
 		.pcpi_rd   (pcpi_rd_1   ),
 		.pcpi_wait (pcpi_wait_1 ),
 		.pcpi_ready(pcpi_ready_1),
-
+		.mul_req   (1'b0        ),
+		.mul_a     (33'd0       ),
+		.mul_b     (33'd0       ),
+		.mul_y     (            ),
 	);
 
 	always @(posedge clk) begin
@@ -1,8 +1,8 @@
 #!/bin/bash
 
 dashes="----------------------------------------------------------------"
-printf '| %-25s | %-10s | %-20s |\n' "Device" "Speedgrade" "Clock Period (Freq.)"
-printf '|:%.25s |:%.10s:| %.20s:|\n' $dashes $dashes $dashes
+printf '| %-25s | %-10s | %-20s | %-18s | %-10s | %-15s |\n' "Device" "Speedgrade" "Clock Period (Freq.)" "Configuration" "Slice LUTs" "DSPs"
+printf '|:%.25s |:%.10s:| %.20s:|:%.18s |%.10s:|%.15s:|\n' $dashes $dashes $dashes $dashes $dashes $dashes
 
 for x in $( grep -H . tab_*/results.txt )
 do
@@ -16,6 +16,17 @@ do
 		xckup) d="Xilinx Kintex UltraScale+" ;;
 		xcvup) d="Xilinx Virtex UltraScale+" ;;
 	esac
+	case "$size" in
+		small)    c="small, no audio" ;;
+		audio)    c="audio, all ops" ;;
+		audiomac) c="audio, MAC ops" ;;
+		audiofir) c="audio, FIR ops" ;;
+		audiofft) c="audio, FFT ops" ;;
+		*)        c="$size" ;;
+	esac
+	log=tab_${size}_${device}_${grade}/test_${speed}.txt
+	area=$( grep -m1 -E '^\| (Slice|CLB) LUTs ' $log | awk -F'|' '{ gsub(/ /, "", $3); print $3 }' )
+	dsps=$( grep -m1 -E '^\| DSPs ' $log | awk -F'|' '{ gsub(/ /, "", $3); print $3 }' )
 	speedtxt=$( printf '%s.%s ns (%d MHz)' ${speed%?} ${speed#?} $((10000 / speed)) )
-	printf '| %-25s | %-10s | %20s |\n' "$d" "-$grade" "$speedtxt"
+	printf '| %-25s | %-10s | %20s | %-18s | %10s | %15s |\n' "$d" "-$grade" "$speedtxt" "$c" "$area" "$dsps"
 done
@@ -3,6 +3,17 @@
 set -e
 read _ ip dev grade _ < <( echo $* | tr '_/' ' '; )
 
+# The first part of tab_<ip>_<dev>_<grade> selects the core configuration:
+# "small" is the plain core, "audio*" add the audio unit with a subset of
+# AUX ops (AUDIO_OPS bit n enables funct7 0x20 + n).
+case "${ip}" in
+	audio)    audio=1; audio_ops=ffffffff ;;  # all ops
+	audiomac) audio=1; audio_ops=00301c03 ;;  # MAC16 MSUB16 MACA ACCRD ACCCLR MACC16 MSUBC16
+	audiofir) audio=1; audio_ops=00083f18 ;;  # CONV4 CONV8 CLIP16 SHIFTN MACA ACCRD ACCCLR BIQUAD CIRC
+	audiofft) audio=1; audio_ops=0001c0c0 ;;  # CMAC ABS2 BFLY LANE16 MULQ15
+	*)        audio=0; audio_ops=ffffffff ;;
+esac
+
 # rm -rf tab_${ip}_${dev}_${grade}
 mkdir -p tab_${ip}_${dev}_${grade}
 cd tab_${ip}_${dev}_${grade}
@@ -30,7 +41,7 @@ synth_case() {
 		read_verilog ../tabtest.v
 		read_verilog ../../../picorv32.v
 		read_xdc test_${1}.xdc
-		synth_design -flatten_hierarchy full -part ${xl_device} -top top
+		synth_design -flatten_hierarchy full -part ${xl_device} -top top -generic ENABLE_AUDIO=${audio} -generic AUDIO_OPS=32'h${audio_ops}
 		opt_design -sweep -remap -propconst
 		opt_design -directive Explore
 		place_design -directive Explore
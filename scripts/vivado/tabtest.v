@@ -1,5 +1,8 @@
 
-module top (
+module top #(
+	parameter [ 0:0] ENABLE_AUDIO = 0,
+	parameter [31:0] AUDIO_OPS = 32'hffff_ffff
+) (
 	input clk, io_resetn,
 	output io_trap,
 
@@ -73,7 +76,9 @@ module top (
 	delay4 #(32) delay_eoi             (clk,    eoi            , io_eoi            );
 
 	picorv32_axi #(
-		.TWO_CYCLE_ALU(1)
+		.TWO_CYCLE_ALU(1),
+		.ENABLE_AUDIO (ENABLE_AUDIO),
+		.AUDIO_OPS    (AUDIO_OPS)
 	) cpu (
 		.clk            (clk            ),
 		.resetn         (resetn         ),
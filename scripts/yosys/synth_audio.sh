@@ -0,0 +1,30 @@
+#!/bin/bash
+#
+# Area and logic depth of the audio PCPI unit for AUDIO_PIPELINE_STAGES=0/1/2
+# and for AUDIO_SHARED_MUL=0/1 (with ENABLE_FAST_MUL).
+# "ltp -noff" reports the longest combinational path in cells, which is a
+# technology independent stand-in for fmax. Use scripts/vivado (make audio)
+# for real timing numbers.
+#
+set -ex
+for stages in 0 1 2; do
+	yosys -l synth_audio_s${stages}.log -p "
+		read_verilog ../../picorv32.v
+		chparam -set ENABLE_AUDIO 1 -set AUDIO_PIPELINE_STAGES ${stages} picorv32
+		synth_xilinx -top picorv32
+		stat
+		ltp -noff
+	"
+done
+# FAST_MUL plus the audio unit, with and without AUDIO_SHARED_MUL
+for shared in 0 1; do
+	yosys -l synth_audio_m${shared}.log -p "
+		read_verilog ../../picorv32.v
+		chparam -set ENABLE_FAST_MUL 1 -set ENABLE_AUDIO 1 -set AUDIO_SHARED_MUL ${shared} picorv32
+		synth_xilinx -top picorv32
+		stat
+		ltp -noff
+	"
+done
+grep -A40 'Printing statistics' synth_audio_s*.log synth_audio_m*.log | grep -E 'LUT|DSP48|FD'
+grep 'Longest topological path' synth_audio_s*.log synth_audio_m*.log
@@ -171,6 +171,14 @@ module picorv32_wrapper #(
 		.ENABLE_MUL(1),
 		.ENABLE_DIV(1),
 		.ENABLE_AUDIO(1),
+		.ENABLE_HWLOOP(1),
+		.ENABLE_POSTINC(1),
+`ifdef AUDIO_PIPELINE_STAGES
+		.AUDIO_PIPELINE_STAGES(`AUDIO_PIPELINE_STAGES),
+`endif
+`ifdef AUDIO_FAST_DECODE
+		.AUDIO_FAST_DECODE(1),
+`endif
 		.ENABLE_IRQ(1),
 		.ENABLE_TRACE(1)
 `endif